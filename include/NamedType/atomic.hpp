@@ -0,0 +1,192 @@
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+#include "named_type_impl.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Atomic value of a strong type, with the interface of std::atomic taking and returning the strong type.
+// NamedType<std::atomic<T>, ...> can't be used for this, as NamedType and its skills copy their underlying value.
+template <typename Strong>
+class atomic
+{
+public:
+    using value_type = Strong;
+    using underlying_type = std::remove_reference_t<typename Strong::UnderlyingType>;
+    static_assert(std::is_trivially_copyable<underlying_type>::value,
+                  "fluent::atomic requires a trivially copyable underlying type");
+
+    atomic() noexcept : value_(underlying_type{})
+    {
+    }
+    constexpr atomic(Strong const& desired) noexcept : value_(desired.get())
+    {
+    }
+    atomic(atomic const&) = delete;
+    atomic& operator=(atomic const&) = delete;
+
+    FLUENT_NODISCARD bool is_lock_free() const noexcept
+    {
+        return value_.is_lock_free();
+    }
+
+    FLUENT_NODISCARD Strong load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return Strong(value_.load(order));
+    }
+    void store(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_.store(desired.get(), order);
+    }
+    Strong exchange(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return Strong(value_.exchange(desired.get(), order));
+    }
+
+    // On failure, expected receives the current value
+    bool compare_exchange_weak(Strong& expected,
+                               Strong const& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), order);
+    }
+    bool compare_exchange_weak(Strong& expected,
+                               Strong const& desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), success, failure);
+    }
+    bool compare_exchange_strong(Strong& expected,
+                                 Strong const& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), order);
+    }
+    bool compare_exchange_strong(Strong& expected,
+                                 Strong const& desired,
+                                 std::memory_order success,
+                                 std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), success, failure);
+    }
+
+    // For integral underlying types. Return the previous value
+    Strong fetch_add(Strong const& operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(std::is_integral<underlying_type>::value, "fetch_add requires an integral underlying type");
+        return Strong(value_.fetch_add(operand.get(), order));
+    }
+    Strong fetch_sub(Strong const& operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(std::is_integral<underlying_type>::value, "fetch_sub requires an integral underlying type");
+        return Strong(value_.fetch_sub(operand.get(), order));
+    }
+
+#if defined(__cpp_lib_atomic_wait)
+    void wait(Strong const& old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        value_.wait(old.get(), order);
+    }
+    void notify_one() noexcept
+    {
+        value_.notify_one();
+    }
+    void notify_all() noexcept
+    {
+        value_.notify_all();
+    }
+#endif
+
+private:
+    std::atomic<underlying_type> value_;
+};
+
+#if defined(__cpp_lib_atomic_ref)
+// Atomic access to the value of an existing strong object, with the interface of std::atomic_ref taking and
+// returning the strong type. The object must outlive the atomic_ref, and must only be accessed through atomic_refs
+// while one exists.
+template <typename Strong>
+class atomic_ref
+{
+public:
+    using value_type = Strong;
+    using underlying_type = std::remove_reference_t<typename Strong::UnderlyingType>;
+
+    explicit atomic_ref(Strong& object) noexcept : value_(object.get())
+    {
+    }
+
+    FLUENT_NODISCARD Strong load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return Strong(value_.load(order));
+    }
+    void store(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        value_.store(desired.get(), order);
+    }
+    Strong exchange(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return Strong(value_.exchange(desired.get(), order));
+    }
+    bool compare_exchange_weak(Strong& expected,
+                               Strong const& desired,
+                               std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), order);
+    }
+    bool compare_exchange_weak(Strong& expected,
+                               Strong const& desired,
+                               std::memory_order success,
+                               std::memory_order failure) const noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), success, failure);
+    }
+    bool compare_exchange_strong(Strong& expected,
+                                 Strong const& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), order);
+    }
+    bool compare_exchange_strong(Strong& expected,
+                                 Strong const& desired,
+                                 std::memory_order success,
+                                 std::memory_order failure) const noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), success, failure);
+    }
+    Strong fetch_add(Strong const& operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        static_assert(std::is_integral<underlying_type>::value, "fetch_add requires an integral underlying type");
+        return Strong(value_.fetch_add(operand.get(), order));
+    }
+    Strong fetch_sub(Strong const& operand, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        static_assert(std::is_integral<underlying_type>::value, "fetch_sub requires an integral underlying type");
+        return Strong(value_.fetch_sub(operand.get(), order));
+    }
+    void wait(Strong const& old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        value_.wait(old.get(), order);
+    }
+    void notify_one() const noexcept
+    {
+        value_.notify_one();
+    }
+    void notify_all() const noexcept
+    {
+        value_.notify_all();
+    }
+
+private:
+    std::atomic_ref<underlying_type> value_;
+};
+#endif
+
+} // namespace fluent
+
+#endif
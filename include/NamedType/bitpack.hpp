@@ -0,0 +1,216 @@
+#ifndef BITPACK_HPP
+#define BITPACK_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Field of a bitpack, holding a value of the strong type Strong on Width bits
+template <typename Strong, int Width>
+struct Field
+{
+    using type = Strong;
+    static constexpr int width = Width;
+};
+
+namespace details
+{
+
+template <int Bits>
+using PackedWord = std::conditional_t<
+    Bits <= 8,
+    std::uint8_t,
+    std::conditional_t<Bits <= 16, std::uint16_t, std::conditional_t<Bits <= 32, std::uint32_t, std::uint64_t>>>;
+
+template <typename Strong, typename... Fields>
+constexpr int bitOffset()
+{
+    bool const isField[] = {std::is_same<Strong, typename Fields::type>::value...};
+    int const widths[] = {Fields::width...};
+    int offset = 0;
+    for (std::size_t i = 0; !isField[i]; ++i)
+    {
+        offset += widths[i];
+    }
+    return offset;
+}
+
+template <typename... Fields>
+constexpr int totalWidth()
+{
+    int const widths[] = {Fields::width...};
+    int total = 0;
+    for (int const width : widths)
+    {
+        total += width;
+    }
+    return total;
+}
+
+template <typename Field>
+struct IsValidField
+{
+    using Underlying = std::remove_reference_t<typename Field::type::UnderlyingType>;
+    static constexpr bool value =
+        Field::width > 0 && (std::is_integral<Underlying>::value || std::is_enum<Underlying>::value);
+};
+
+} // namespace details
+
+// Values of several strong types packed in one unsigned integer, each on the number of bits given by its Field:
+//
+//     using Header = fluent::bitpack<fluent::Field<Priority, 3>, fluent::Field<ShardId, 10>>;
+//     Header header(ShardId{42}, Priority{5}); // fields in any order
+//     ShardId const shard = header.get<ShardId>();
+//
+// The fields are laid out from the least significant bit in declaration order, and are accessed with one shift and one
+// mask. Values of signed types are sign extended when read. Storing a value that does not fit in its field is checked
+// with FLUENT_ASSERT.
+template <typename... Fields>
+class bitpack
+{
+    static_assert(sizeof...(Fields) > 0, "a bitpack has at least one field");
+    static_assert(details::AreDistinct<typename Fields::type...>::value,
+                  "the fields of a bitpack must have distinct types");
+    static_assert(details::AllOf<details::IsValidField<Fields>::value...>::value,
+                  "bitpack fields have positive widths and integral or enum underlying types");
+    static_assert(details::totalWidth<Fields...>() <= 64, "the fields of a bitpack must fit in 64 bits");
+
+    template <typename... Values>
+    using IfAreFields =
+        std::enable_if_t<sizeof...(Values) == sizeof...(Fields)
+                         && details::AreDistinct<std::decay_t<Values>...>::value
+                         && details::AllOf<(details::CountOf<std::decay_t<Values>, typename Fields::type...>::value
+                                            == 1)...>::value>;
+
+public:
+    using word_type = details::PackedWord<details::totalWidth<Fields...>()>;
+
+    constexpr bitpack() noexcept : word_(0)
+    {
+    }
+
+    // The fields can be passed in any order, as they are identified by their types
+    template <typename... Values, typename = IfAreFields<Values...>>
+    FLUENT_CONSTEXPR17 explicit bitpack(Values const&... values) noexcept : word_(0)
+    {
+        using expand = int[];
+        static_cast<void>(expand{0, (set(values), 0)...});
+    }
+
+    template <typename Strong>
+    FLUENT_NODISCARD constexpr Strong get() const noexcept
+    {
+        static_assert(details::CountOf<Strong, typename Fields::type...>::value == 1,
+                      "this field is not in the bitpack");
+        using Underlying = std::remove_reference_t<typename Strong::UnderlyingType>;
+        return Strong(static_cast<Underlying>(extract<Strong>(IsSigned<Strong>{})));
+    }
+
+    template <typename Strong>
+    FLUENT_CONSTEXPR17 void set(Strong const& value) noexcept
+    {
+        static_assert(details::CountOf<Strong, typename Fields::type...>::value == 1,
+                      "this field is not in the bitpack");
+        word_type const bits = static_cast<word_type>(value.get());
+        FLUENT_ASSERT(fits<Strong>(value.get()));
+        constexpr word_type fieldMask = static_cast<word_type>(mask<Strong>() << offset<Strong>());
+        word_ = static_cast<word_type>((word_ & ~fieldMask) | ((bits << offset<Strong>()) & fieldMask));
+    }
+
+    // The packed word, for storage and transmission
+    FLUENT_NODISCARD constexpr word_type raw() const noexcept
+    {
+        return word_;
+    }
+    FLUENT_NODISCARD static constexpr bitpack fromRaw(word_type word) noexcept
+    {
+        return bitpack(word, RawTag{});
+    }
+
+    FLUENT_NODISCARD friend constexpr bool operator==(bitpack const& lhs, bitpack const& rhs) noexcept
+    {
+        return lhs.word_ == rhs.word_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(bitpack const& lhs, bitpack const& rhs) noexcept
+    {
+        return lhs.word_ != rhs.word_;
+    }
+
+private:
+    struct RawTag
+    {
+    };
+
+    constexpr bitpack(word_type word, RawTag) noexcept : word_(word)
+    {
+    }
+
+    template <typename Strong>
+    static constexpr int width() noexcept
+    {
+        int const widths[] = {(std::is_same<Strong, typename Fields::type>::value ? Fields::width : 0)...};
+        int total = 0;
+        for (int const fieldWidth : widths)
+        {
+            total += fieldWidth;
+        }
+        return total;
+    }
+    template <typename Strong>
+    static constexpr int offset() noexcept
+    {
+        return details::bitOffset<Strong, Fields...>();
+    }
+    template <typename Strong>
+    static constexpr word_type mask() noexcept
+    {
+        return static_cast<word_type>(static_cast<word_type>(~word_type{0})
+                                      >> (sizeof(word_type) * 8 - static_cast<std::size_t>(width<Strong>())));
+    }
+
+    template <typename Strong>
+    using IsSigned = std::is_signed<std::remove_reference_t<typename Strong::UnderlyingType>>;
+
+    template <typename Strong>
+    constexpr word_type extract(std::false_type) const noexcept
+    {
+        return static_cast<word_type>((word_ >> offset<Strong>()) & mask<Strong>());
+    }
+    template <typename Strong>
+    constexpr std::int64_t extract(std::true_type) const noexcept
+    {
+        // Moves the field to the top bits, and shifts it back arithmetically to extend its sign
+        return static_cast<std::int64_t>(static_cast<std::uint64_t>(word_) << (64 - offset<Strong>() - width<Strong>()))
+               >> (64 - width<Strong>());
+    }
+
+    template <typename Strong, typename Underlying>
+    static constexpr bool fits(Underlying value) noexcept
+    {
+        return width<Strong>() >= 64 || fitsIn(value, width<Strong>(), IsSigned<Strong>{});
+    }
+    template <typename Underlying>
+    static constexpr bool fitsIn(Underlying value, int bits, std::true_type) noexcept
+    {
+        return static_cast<std::int64_t>(value) >= -(std::int64_t{1} << (bits - 1))
+               && static_cast<std::int64_t>(value) < (std::int64_t{1} << (bits - 1));
+    }
+    template <typename Underlying>
+    static constexpr bool fitsIn(Underlying value, int bits, std::false_type) noexcept
+    {
+        return static_cast<std::uint64_t>(value) < (std::uint64_t{1} << bits);
+    }
+
+    word_type word_;
+};
+
+} // namespace fluent
+
+#endif
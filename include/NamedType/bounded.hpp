@@ -0,0 +1,203 @@
+#ifndef BOUNDED_HPP
+#define BOUNDED_HPP
+
+#include "checked_arithmetic.hpp"
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if FLUENT_HOSTED == 1
+#    include <ostream>
+#endif
+
+namespace fluent
+{
+
+namespace details
+{
+
+template <typename Integer>
+constexpr bool fitsIn(std::intmax_t min, std::intmax_t max)
+{
+    // A negative max fits in any signed type holding min, and converting it to an unsigned type would make it huge
+    return (std::is_signed<Integer>::value || min >= 0)
+           && min >= static_cast<std::intmax_t>(std::numeric_limits<Integer>::min())
+           && (max < 0
+               || static_cast<std::uintmax_t>(max) <= static_cast<std::uintmax_t>(std::numeric_limits<Integer>::max()));
+}
+
+// Smallest integer type holding [Min, Max], unsigned if Min is not negative
+template <std::intmax_t Min, std::intmax_t Max>
+using SmallestInteger = std::conditional_t<
+    fitsIn<std::uint8_t>(Min, Max),
+    std::uint8_t,
+    std::conditional_t<
+        fitsIn<std::int8_t>(Min, Max),
+        std::int8_t,
+        std::conditional_t<
+            fitsIn<std::uint16_t>(Min, Max),
+            std::uint16_t,
+            std::conditional_t<
+                fitsIn<std::int16_t>(Min, Max),
+                std::int16_t,
+                std::conditional_t<
+                    fitsIn<std::uint32_t>(Min, Max),
+                    std::uint32_t,
+                    std::conditional_t<
+                        fitsIn<std::int32_t>(Min, Max),
+                        std::int32_t,
+                        std::conditional_t<Min >= 0, std::uint64_t, std::int64_t>>>>>>>;
+
+} // namespace details
+
+// Integer in [Min, Max], stored in the smallest integer type that holds this range.
+// The range is checked on construction, and assumed when the value is read.
+//
+//     using Percentage = NamedType<Bounded<0, 100>, struct PercentageTag, Comparable>; // 1 byte
+template <std::intmax_t Min, std::intmax_t Max>
+class Bounded
+{
+public:
+    static_assert(Min <= Max, "Bounded requires Min <= Max");
+
+    using rep = details::SmallestInteger<Min, Max>;
+    static constexpr std::intmax_t min = Min;
+    static constexpr std::intmax_t max = Max;
+
+    constexpr Bounded() noexcept : value_(static_cast<rep>(Min))
+    {
+    }
+
+    // Throws std::out_of_range if value is not in [Min, Max]
+    explicit constexpr Bounded(std::intmax_t value) : value_(checked(value))
+    {
+    }
+
+    FLUENT_NODISCARD static constexpr bool contains(std::intmax_t value) noexcept
+    {
+        return value >= Min && value <= Max;
+    }
+
+    FLUENT_NODISCARD constexpr rep value() const noexcept
+    {
+        FLUENT_ASSUME(contains(value_));
+        return value_;
+    }
+
+    // arithmetic, checking that the result stays in range, including when it overflows std::intmax_t
+    FLUENT_NODISCARD constexpr Bounded operator+(Bounded const& other) const
+    {
+        return Bounded(combined(static_cast<std::intmax_t>(value()), other.value(), details::AddOverflow{}));
+    }
+    FLUENT_NODISCARD constexpr Bounded operator-(Bounded const& other) const
+    {
+        return Bounded(combined(static_cast<std::intmax_t>(value()), other.value(), details::SubOverflow{}));
+    }
+    FLUENT_CONSTEXPR17 Bounded& operator+=(Bounded const& other)
+    {
+        return *this = *this + other;
+    }
+    FLUENT_CONSTEXPR17 Bounded& operator-=(Bounded const& other)
+    {
+        return *this = *this - other;
+    }
+    FLUENT_CONSTEXPR17 Bounded& operator++()
+    {
+        return *this = Bounded(combined(static_cast<std::intmax_t>(value()), 1, details::AddOverflow{}));
+    }
+    FLUENT_CONSTEXPR17 Bounded operator++(int)
+    {
+        Bounded const old = *this;
+        ++*this;
+        return old;
+    }
+    FLUENT_CONSTEXPR17 Bounded& operator--()
+    {
+        return *this = Bounded(combined(static_cast<std::intmax_t>(value()), 1, details::SubOverflow{}));
+    }
+    FLUENT_CONSTEXPR17 Bounded operator--(int)
+    {
+        Bounded const old = *this;
+        --*this;
+        return old;
+    }
+
+    // comparison
+    FLUENT_NODISCARD friend constexpr bool operator==(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() == rhs.value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() != rhs.value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() < rhs.value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() > rhs.value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<=(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() <= rhs.value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>=(Bounded const& lhs, Bounded const& rhs) noexcept
+    {
+        return lhs.value() >= rhs.value();
+    }
+
+private:
+    template <typename Overflows>
+    static constexpr std::intmax_t combined(std::intmax_t lhs, std::intmax_t rhs, Overflows overflows)
+    {
+        std::intmax_t result = 0;
+        return overflows(lhs, rhs, result) ? throw std::out_of_range("fluent::Bounded: value out of range") : result;
+    }
+
+    static constexpr rep checked(std::intmax_t value)
+    {
+        return contains(value) ? static_cast<rep>(value)
+                               : throw std::out_of_range("fluent::Bounded: value out of range");
+    }
+
+    rep value_;
+};
+
+template <std::intmax_t Min, std::intmax_t Max>
+constexpr std::intmax_t Bounded<Min, Max>::min;
+
+template <std::intmax_t Min, std::intmax_t Max>
+constexpr std::intmax_t Bounded<Min, Max>::max;
+
+#if FLUENT_HOSTED == 1
+// Printed as a number, even when stored in a character type
+template <std::intmax_t Min, std::intmax_t Max>
+std::ostream& operator<<(std::ostream& os, Bounded<Min, Max> const& value)
+{
+    return os << +value.value();
+}
+#endif
+
+} // namespace fluent
+
+namespace std
+{
+template <std::intmax_t Min, std::intmax_t Max>
+struct hash<fluent::Bounded<Min, Max>>
+{
+    size_t operator()(fluent::Bounded<Min, Max> const& x) const noexcept
+    {
+        return std::hash<typename fluent::Bounded<Min, Max>::rep>()(x.value());
+    }
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef BYTE_ORDER_HPP
+#define BYTE_ORDER_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#    include <cstdlib>
+#endif
+
+// Targets are considered little endian unless the compiler says otherwise
+#ifndef FLUENT_BIG_ENDIAN_TARGET
+#    if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#        define FLUENT_BIG_ENDIAN_TARGET 1
+#    else
+#        define FLUENT_BIG_ENDIAN_TARGET 0
+#    endif
+#endif
+
+namespace fluent
+{
+
+namespace details
+{
+
+template <std::size_t Size>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1>
+{
+    using type = std::uint8_t;
+};
+template <>
+struct UnsignedOfSize<2>
+{
+    using type = std::uint16_t;
+};
+template <>
+struct UnsignedOfSize<4>
+{
+    using type = std::uint32_t;
+};
+template <>
+struct UnsignedOfSize<8>
+{
+    using type = std::uint64_t;
+};
+
+inline std::uint8_t byteSwap(std::uint8_t bits) noexcept
+{
+    return bits;
+}
+
+#if defined(__clang__) || defined(__GNUC__)
+inline std::uint16_t byteSwap(std::uint16_t bits) noexcept
+{
+    return __builtin_bswap16(bits);
+}
+inline std::uint32_t byteSwap(std::uint32_t bits) noexcept
+{
+    return __builtin_bswap32(bits);
+}
+inline std::uint64_t byteSwap(std::uint64_t bits) noexcept
+{
+    return __builtin_bswap64(bits);
+}
+#elif defined(_MSC_VER)
+inline std::uint16_t byteSwap(std::uint16_t bits) noexcept
+{
+    return _byteswap_ushort(bits);
+}
+inline std::uint32_t byteSwap(std::uint32_t bits) noexcept
+{
+    return _byteswap_ulong(bits);
+}
+inline std::uint64_t byteSwap(std::uint64_t bits) noexcept
+{
+    return _byteswap_uint64(bits);
+}
+#else
+template <typename Bits>
+Bits byteSwap(Bits bits) noexcept
+{
+    Bits swapped = 0;
+    for (std::size_t i = 0; i < sizeof(Bits); ++i)
+    {
+        swapped = static_cast<Bits>(static_cast<Bits>(swapped << 8) | (bits & 0xFFu));
+        bits = static_cast<Bits>(bits >> 8);
+    }
+    return swapped;
+}
+#endif
+
+// Bytes in the order of the target if Swapped is false, in the reverse order otherwise
+template <bool Swapped>
+struct ByteOrder
+{
+    template <typename Bits>
+    static Bits load(unsigned char const* bytes) noexcept
+    {
+        Bits bits;
+        std::memcpy(&bits, bytes, sizeof(Bits));
+        return Swapped ? byteSwap(bits) : bits;
+    }
+    template <typename Bits>
+    static void store(Bits bits, unsigned char* bytes) noexcept
+    {
+        if (Swapped)
+        {
+            bits = byteSwap(bits);
+        }
+        std::memcpy(bytes, &bits, sizeof(Bits));
+    }
+};
+
+using NativeOrder = ByteOrder<false>;
+using BigEndianOrder = ByteOrder<!FLUENT_BIG_ENDIAN_TARGET>;
+using LittleEndianOrder = ByteOrder<FLUENT_BIG_ENDIAN_TARGET>;
+
+// Value of a strong type stored as bytes in the given order, without alignment requirement
+template <typename Strong, typename Order>
+class ByteOrderedValue
+{
+public:
+    using strong_type = Strong;
+    using underlying_type = std::remove_reference_t<typename Strong::UnderlyingType>;
+    static_assert(std::is_arithmetic<underlying_type>::value,
+                  "byte ordered values require an arithmetic underlying type");
+
+    // Leaves the bytes uninitialized, as for types that overlay received bytes
+    ByteOrderedValue() = default;
+
+    explicit ByteOrderedValue(Strong const& value) noexcept : bytes_()
+    {
+        set(value);
+    }
+    ByteOrderedValue& operator=(Strong const& value) noexcept
+    {
+        set(value);
+        return *this;
+    }
+
+    // The bytes are decoded on each access
+    FLUENT_NODISCARD Strong get() const noexcept
+    {
+        Bits const bits = Order::template load<Bits>(bytes_);
+        underlying_type value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return Strong(value);
+    }
+    operator Strong() const noexcept
+    {
+        return get();
+    }
+    void set(Strong const& value) noexcept
+    {
+        Bits bits;
+        std::memcpy(&bits, &value.get(), sizeof(bits));
+        Order::store(bits, bytes_);
+    }
+
+    // Comparisons through the ones of Strong, with byte ordered values and with Strong
+    FLUENT_NODISCARD friend bool operator==(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() == rhs;
+    }
+    FLUENT_NODISCARD friend bool operator!=(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() != rhs;
+    }
+    FLUENT_NODISCARD friend bool operator<(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() < rhs;
+    }
+    FLUENT_NODISCARD friend bool operator>(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() > rhs;
+    }
+    FLUENT_NODISCARD friend bool operator<=(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() <= rhs;
+    }
+    FLUENT_NODISCARD friend bool operator>=(ByteOrderedValue const& lhs, Strong const& rhs)
+    {
+        return lhs.get() >= rhs;
+    }
+
+private:
+    using Bits = typename UnsignedOfSize<sizeof(underlying_type)>::type;
+
+    unsigned char bytes_[sizeof(underlying_type)];
+};
+
+} // namespace details
+
+// Values of strong types stored in a given byte order, with an alignment of 1, to describe the layout of network
+// messages or file headers. Structs of such values can overlay received or mapped bytes, and decode their fields when
+// they are accessed:
+//
+//     struct Header
+//     {
+//         BigEndian<MessageLength> length;
+//         BigEndian<SequenceNumber> sequence;
+//     };
+//     Header const& header = overlay<Header>(buffer);
+//     MessageLength const length = header.length.get();
+
+template <typename Strong>
+using BigEndian = details::ByteOrderedValue<Strong, details::BigEndianOrder>;
+
+template <typename Strong>
+using LittleEndian = details::ByteOrderedValue<Strong, details::LittleEndianOrder>;
+
+// In the byte order of the target
+template <typename Strong>
+using Unaligned = details::ByteOrderedValue<Strong, details::NativeOrder>;
+
+// Views bytes as a struct of byte ordered values, without copying them
+template <typename Message>
+FLUENT_NODISCARD Message const& overlay(void const* bytes) noexcept
+{
+    static_assert(alignof(Message) == 1, "overlaid types must not have alignment requirements");
+    static_assert(std::is_trivially_copyable<Message>::value && std::is_standard_layout<Message>::value,
+                  "overlaid types must be trivially copyable and standard layout");
+    return *static_cast<Message const*>(bytes);
+}
+template <typename Message>
+FLUENT_NODISCARD Message& overlay(void* bytes) noexcept
+{
+    static_assert(alignof(Message) == 1, "overlaid types must not have alignment requirements");
+    static_assert(std::is_trivially_copyable<Message>::value && std::is_standard_layout<Message>::value,
+                  "overlaid types must be trivially copyable and standard layout");
+    return *static_cast<Message*>(bytes);
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef CACHE_ALIGNED_HPP
+#define CACHE_ALIGNED_HPP
+
+#include "crtp.hpp"
+
+#include <cstddef>
+
+// Size of the cache lines of the target, that objects accessed by different threads should not share.
+// std::hardware_destructive_interference_size is not used as its value can change with compiler flags, which would
+// change the layout of the types using it between translation units. Define FLUENT_CACHE_LINE_SIZE to override it.
+#ifndef FLUENT_CACHE_LINE_SIZE
+#    define FLUENT_CACHE_LINE_SIZE 64
+#endif
+
+namespace fluent
+{
+
+constexpr std::size_t cache_line_size = FLUENT_CACHE_LINE_SIZE;
+
+// Aligns the strong type on a cache line and pads it to the size of a cache line, so that two objects of this type
+// never share a cache line, and a thread writing to one does not slow down the threads accessing the others.
+template <typename T>
+struct alignas(cache_line_size) CacheAligned : crtp<T, CacheAligned>
+{
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,370 @@
+#ifndef CHECKED_ARITHMETIC_HPP
+#define CHECKED_ARITHMETIC_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// Use the compiler's overflow-checking builtins if available
+#ifndef FLUENT_OVERFLOW_BUILTINS
+#    if defined(__clang__) || defined(__GNUC__)
+#        define FLUENT_OVERFLOW_BUILTINS 1
+#    else
+#        define FLUENT_OVERFLOW_BUILTINS 0
+#    endif
+#endif
+
+namespace fluent
+{
+
+namespace details
+{
+
+template <typename T>
+constexpr bool isNegative(T value, std::true_type /* is_signed */)
+{
+    return value < 0;
+}
+
+template <typename T>
+constexpr bool isNegative(T, std::false_type /* is_signed */)
+{
+    return false;
+}
+
+template <typename T>
+constexpr bool isNegative(T value)
+{
+    return isNegative(value, std::is_signed<T>{});
+}
+
+#if FLUENT_OVERFLOW_BUILTINS
+
+template <typename T>
+constexpr bool addOverflow(T a, T b, T& result)
+{
+    return __builtin_add_overflow(a, b, &result);
+}
+
+template <typename T>
+constexpr bool subOverflow(T a, T b, T& result)
+{
+    return __builtin_sub_overflow(a, b, &result);
+}
+
+template <typename T>
+constexpr bool mulOverflow(T a, T b, T& result)
+{
+    return __builtin_mul_overflow(a, b, &result);
+}
+
+#else
+
+// Portable fallbacks: the wrapped result is computed in the unsigned type, where overflow is well defined.
+template <typename T>
+constexpr T wrap(std::make_unsigned_t<T> value)
+{
+    return static_cast<T>(value);
+}
+
+template <typename T>
+constexpr bool addOverflow(T a, T b, T& result)
+{
+    using U = std::make_unsigned_t<T>;
+    result = wrap<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+    return isNegative(b) ? a < std::numeric_limits<T>::min() - b : a > std::numeric_limits<T>::max() - b;
+}
+
+template <typename T>
+constexpr bool subOverflow(T a, T b, T& result)
+{
+    using U = std::make_unsigned_t<T>;
+    result = wrap<T>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+    return isNegative(b) ? a > std::numeric_limits<T>::max() + b : a < std::numeric_limits<T>::min() + b;
+}
+
+template <typename T>
+constexpr bool mulOverflow(T a, T b, T& result)
+{
+    using U = std::make_unsigned_t<T>;
+    result = wrap<T>(static_cast<U>(static_cast<U>(a) * static_cast<U>(b)));
+    if (a == 0 || b == 0)
+    {
+        return false;
+    }
+    if (isNegative(a) != isNegative(b))
+    {
+        return isNegative(a) ? a < std::numeric_limits<T>::min() / b : b < std::numeric_limits<T>::min() / a;
+    }
+    return isNegative(a) ? a < std::numeric_limits<T>::max() / b : a > std::numeric_limits<T>::max() / b;
+}
+
+#endif
+
+struct AddOverflow
+{
+    template <typename T>
+    constexpr bool operator()(T a, T b, T& result) const
+    {
+        return addOverflow(a, b, result);
+    }
+};
+
+struct SubOverflow
+{
+    template <typename T>
+    constexpr bool operator()(T a, T b, T& result) const
+    {
+        return subOverflow(a, b, result);
+    }
+};
+
+struct MulOverflow
+{
+    template <typename T>
+    constexpr bool operator()(T a, T b, T& result) const
+    {
+        return mulOverflow(a, b, result);
+    }
+};
+
+// The saturated values are selected rather than branched to, so that the compiler emits conditional moves.
+template <typename T>
+constexpr T saturatingAdd(T a, T b)
+{
+    T result{};
+    bool const overflow = addOverflow(a, b, result);
+    T const limit = isNegative(b) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    return overflow ? limit : result;
+}
+
+template <typename T>
+constexpr T saturatingSub(T a, T b)
+{
+    T result{};
+    bool const overflow = subOverflow(a, b, result);
+    T const limit = isNegative(b) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+    return overflow ? limit : result;
+}
+
+template <typename T>
+constexpr T saturatingMul(T a, T b)
+{
+    T result{};
+    bool const overflow = mulOverflow(a, b, result);
+    T const limit = isNegative(a) != isNegative(b) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    return overflow ? limit : result;
+}
+
+} // namespace details
+
+// Overflow policies of CheckedArithmeticWith
+
+struct ThrowOnOverflow
+{
+    static void onOverflow()
+    {
+        throw std::overflow_error("fluent::NamedType: arithmetic overflow");
+    }
+};
+
+struct TrapOnOverflow
+{
+    static void onOverflow() noexcept
+    {
+#if FLUENT_OVERFLOW_BUILTINS
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+};
+
+// Leaves the wrapped result in place and raises a sticky, per-thread flag.
+struct FlagOnOverflow
+{
+    static void onOverflow() noexcept
+    {
+        flag() = true;
+    }
+    static bool raised() noexcept
+    {
+        return flag();
+    }
+    static void clear() noexcept
+    {
+        flag() = false;
+    }
+
+private:
+    static bool& flag() noexcept
+    {
+        static thread_local bool overflowed = false;
+        return overflowed;
+    }
+};
+
+template <typename OverflowPolicy>
+struct CheckedArithmeticWith
+{
+    template <typename T>
+    struct templ : crtp<T, templ>
+    {
+        FLUENT_NODISCARD constexpr T operator+(T const& other) const
+        {
+            return T(checked(details::AddOverflow{}, this->underlying().get(), other.get()));
+        }
+        FLUENT_CONSTEXPR17 T& operator+=(T const& other)
+        {
+            this->underlying().get() = checked(details::AddOverflow{}, this->underlying().get(), other.get());
+            return this->underlying();
+        }
+        FLUENT_NODISCARD constexpr T operator-(T const& other) const
+        {
+            return T(checked(details::SubOverflow{}, this->underlying().get(), other.get()));
+        }
+        FLUENT_NODISCARD constexpr T operator-() const
+        {
+            return T(checked(details::SubOverflow{}, zero(), this->underlying().get()));
+        }
+        FLUENT_CONSTEXPR17 T& operator-=(T const& other)
+        {
+            this->underlying().get() = checked(details::SubOverflow{}, this->underlying().get(), other.get());
+            return this->underlying();
+        }
+        FLUENT_NODISCARD constexpr T operator*(T const& other) const
+        {
+            return T(checked(details::MulOverflow{}, this->underlying().get(), other.get()));
+        }
+        FLUENT_CONSTEXPR17 T& operator*=(T const& other)
+        {
+            this->underlying().get() = checked(details::MulOverflow{}, this->underlying().get(), other.get());
+            return this->underlying();
+        }
+
+        IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
+
+        FLUENT_CONSTEXPR17 T& operator++()
+        {
+            this->underlying().get() = checked(details::AddOverflow{}, this->underlying().get(), one());
+            return this->underlying();
+        }
+        FLUENT_CONSTEXPR17 T operator++(int)
+        {
+            T const old = this->underlying();
+            ++*this;
+            return old;
+        }
+        FLUENT_CONSTEXPR17 T& operator--()
+        {
+            this->underlying().get() = checked(details::SubOverflow{}, this->underlying().get(), one());
+            return this->underlying();
+        }
+        FLUENT_CONSTEXPR17 T operator--(int)
+        {
+            T const old = this->underlying();
+            --*this;
+            return old;
+        }
+
+        IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
+
+    private:
+        constexpr auto zero() const
+        {
+            return std::remove_cv_t<std::remove_reference_t<decltype(this->underlying().get())>>{0};
+        }
+        constexpr auto one() const
+        {
+            return std::remove_cv_t<std::remove_reference_t<decltype(this->underlying().get())>>{1};
+        }
+
+        template <typename Operation, typename Underlying>
+        static constexpr Underlying checked(Operation operation, Underlying a, Underlying b)
+        {
+            static_assert(
+                std::is_integral<Underlying>::value, "checked arithmetic requires an integral underlying type");
+            Underlying result{};
+            if (operation(a, b, result))
+            {
+                OverflowPolicy::onOverflow();
+            }
+            return result;
+        }
+    };
+};
+
+template <typename T>
+struct CheckedArithmetic : CheckedArithmeticWith<ThrowOnOverflow>::templ<T>
+{
+};
+
+template <typename T>
+struct SaturatingArithmetic : crtp<T, SaturatingArithmetic>
+{
+    FLUENT_NODISCARD constexpr T operator+(T const& other) const
+    {
+        return T(details::saturatingAdd(this->underlying().get(), other.get()));
+    }
+    FLUENT_CONSTEXPR17 T& operator+=(T const& other)
+    {
+        this->underlying().get() = details::saturatingAdd(this->underlying().get(), other.get());
+        return this->underlying();
+    }
+    FLUENT_NODISCARD constexpr T operator-(T const& other) const
+    {
+        return T(details::saturatingSub(this->underlying().get(), other.get()));
+    }
+    FLUENT_CONSTEXPR17 T& operator-=(T const& other)
+    {
+        this->underlying().get() = details::saturatingSub(this->underlying().get(), other.get());
+        return this->underlying();
+    }
+    FLUENT_NODISCARD constexpr T operator*(T const& other) const
+    {
+        return T(details::saturatingMul(this->underlying().get(), other.get()));
+    }
+    FLUENT_CONSTEXPR17 T& operator*=(T const& other)
+    {
+        this->underlying().get() = details::saturatingMul(this->underlying().get(), other.get());
+        return this->underlying();
+    }
+
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
+
+    FLUENT_CONSTEXPR17 T& operator++()
+    {
+        auto& value = this->underlying().get();
+        value = details::saturatingAdd(value, std::remove_reference_t<decltype(value)>{1});
+        return this->underlying();
+    }
+    FLUENT_CONSTEXPR17 T operator++(int)
+    {
+        T const old = this->underlying();
+        ++*this;
+        return old;
+    }
+    FLUENT_CONSTEXPR17 T& operator--()
+    {
+        auto& value = this->underlying().get();
+        value = details::saturatingSub(value, std::remove_reference_t<decltype(value)>{1});
+        return this->underlying();
+    }
+    FLUENT_CONSTEXPR17 T operator--(int)
+    {
+        T const old = this->underlying();
+        --*this;
+        return old;
+    }
+
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,343 @@
+#ifndef COLUMN_FILE_HPP
+#define COLUMN_FILE_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define FLUENT_HAS_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define FLUENT_HAS_MMAP 0
+#endif
+
+#if defined(__has_include)
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
+#if defined(__cpp_lib_span)
+#    include <span>
+#endif
+
+// Files holding a column of values of a trivially copyable type, such as a strong type, in their in-memory
+// representation. A header records the identity and layout of the type, and is checked when the file is opened, so
+// that the values can be used in place by mapping the file in memory instead of being read and copied.
+
+namespace fluent
+{
+
+struct column_file_header
+{
+    char magic[8];
+    std::uint32_t format_version;
+    std::uint32_t byte_order_mark; // written in the byte order of the writer
+    std::uint64_t type_fingerprint;
+    std::uint64_t value_size;
+    std::uint64_t value_alignment;
+    std::uint64_t count;
+    std::uint64_t data_offset; // from the start of the file, aligned for the values
+};
+
+namespace details
+{
+
+constexpr char columnFileMagic[8] = {'F', 'L', 'U', 'E', 'N', 'T', 'C', 'F'};
+constexpr std::uint32_t columnFileVersion = 1;
+constexpr std::uint32_t columnFileByteOrderMark = 0x01020304;
+constexpr std::size_t columnFileDataAlignment = 64;
+
+template <typename... Ts>
+struct TypeList
+{
+};
+
+// Strong types are identified by their underlying type and their tag, so that adding skills keeps files readable
+template <typename T>
+struct ColumnIdentity
+{
+    using type = T;
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct ColumnIdentity<NamedType<T, Parameter, Skills...>>
+{
+    using type = TypeList<T, Parameter>;
+};
+
+template <typename T>
+char const* typeSignature() noexcept
+{
+#if defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+// FNV-1a hash of the name of the type given by the compiler, that is stable for a given compiler
+template <typename T>
+std::uint64_t typeFingerprint() noexcept
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char const* character = typeSignature<typename ColumnIdentity<T>::type>(); *character != '\0'; ++character)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*character)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+template <typename T>
+std::size_t columnDataOffset() noexcept
+{
+    std::size_t const alignment = alignof(T) > columnFileDataAlignment ? alignof(T) : columnFileDataAlignment;
+    return (sizeof(column_file_header) + alignment - 1) / alignment * alignment;
+}
+
+// Returns the number of values
+template <typename T>
+std::size_t checkColumnFileHeader(column_file_header const& header, std::uint64_t fileSize, std::string const& path)
+{
+    auto const fail = [&path](char const* reason) {
+        throw std::runtime_error("fluent: invalid column file " + path + ": " + reason);
+    };
+    if (std::memcmp(header.magic, columnFileMagic, sizeof(columnFileMagic)) != 0)
+    {
+        fail("not a column file");
+    }
+    if (header.format_version != columnFileVersion)
+    {
+        fail("unsupported format version");
+    }
+    if (header.byte_order_mark != columnFileByteOrderMark)
+    {
+        fail("written with another byte order");
+    }
+    if (header.type_fingerprint != typeFingerprint<T>())
+    {
+        fail("holds values of another type");
+    }
+    if (header.value_size != sizeof(T) || header.value_alignment != alignof(T))
+    {
+        fail("holds values of another layout");
+    }
+    if (header.data_offset % alignof(T) != 0 || header.data_offset > fileSize
+        || header.count > (fileSize - header.data_offset) / sizeof(T))
+    {
+        fail("truncated");
+    }
+    return static_cast<std::size_t>(header.count);
+}
+
+} // namespace details
+
+template <typename T>
+void write_column_file(std::string const& path, T const* values, std::size_t count)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "column files hold trivially copyable values");
+    column_file_header header{};
+    std::memcpy(header.magic, details::columnFileMagic, sizeof(header.magic));
+    header.format_version = details::columnFileVersion;
+    header.byte_order_mark = details::columnFileByteOrderMark;
+    header.type_fingerprint = details::typeFingerprint<T>();
+    header.value_size = sizeof(T);
+    header.value_alignment = alignof(T);
+    header.count = count;
+    header.data_offset = details::columnDataOffset<T>();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    std::vector<char> const padding(details::columnDataOffset<T>() - sizeof(header), 0);
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    file.write(reinterpret_cast<char const*>(values), static_cast<std::streamsize>(count * sizeof(T)));
+    if (!file)
+    {
+        throw std::runtime_error("fluent::write_column_file: cannot write " + path);
+    }
+}
+
+template <typename T>
+void write_column_file(std::string const& path, std::vector<T> const& values)
+{
+    write_column_file(path, values.data(), values.size());
+}
+
+// Reads all the values of a column file, for platforms without memory mapping
+template <typename T>
+FLUENT_NODISCARD std::vector<T> read_column_file(std::string const& path)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "column files hold trivially copyable values");
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        throw std::runtime_error("fluent::read_column_file: cannot open " + path);
+    }
+    std::uint64_t const fileSize = static_cast<std::uint64_t>(file.tellg());
+    column_file_header header{};
+    file.seekg(0);
+    if (fileSize < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        throw std::runtime_error("fluent: invalid column file " + path + ": truncated");
+    }
+    std::size_t const count = details::checkColumnFileHeader<T>(header, fileSize, path);
+    file.seekg(static_cast<std::streamoff>(header.data_offset));
+    if (count == 0)
+    {
+        return {};
+    }
+    // The vector is filled with copies of the first value, so that T doesn't need to be default constructible
+    unsigned char first[sizeof(T)];
+    if (!file.read(reinterpret_cast<char*>(first), static_cast<std::streamsize>(sizeof(T))))
+    {
+        throw std::runtime_error("fluent::read_column_file: cannot read " + path);
+    }
+    std::vector<T> values(count, details::fromBytes<T>(first));
+    if (!file.read(reinterpret_cast<char*>(values.data() + 1), static_cast<std::streamsize>((count - 1) * sizeof(T))))
+    {
+        throw std::runtime_error("fluent::read_column_file: cannot read " + path);
+    }
+    return values;
+}
+
+#if FLUENT_HAS_MMAP
+
+// Values of a column file mapped read-only in memory, that are only loaded from disk when they are accessed.
+// The header of the file is checked when it is opened, and std::runtime_error is thrown if it doesn't match T.
+template <typename T>
+class mapped_column
+{
+    static_assert(std::is_trivially_copyable<T>::value, "column files hold trivially copyable values");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = T const*;
+
+    explicit mapped_column(std::string const& path) : mapping_(nullptr), mappingSize_(0), values_(nullptr), size_(0)
+    {
+        int const file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            throw std::runtime_error("fluent::mapped_column: cannot open " + path);
+        }
+        struct stat status = {};
+        if (::fstat(file, &status) != 0 || static_cast<std::uint64_t>(status.st_size) < sizeof(column_file_header))
+        {
+            ::close(file);
+            throw std::runtime_error("fluent: invalid column file " + path + ": truncated");
+        }
+        mappingSize_ = static_cast<std::size_t>(status.st_size);
+        void* const mapping = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file); // the mapping keeps the file open
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("fluent::mapped_column: cannot map " + path);
+        }
+        mapping_ = mapping;
+
+        column_file_header header{};
+        std::memcpy(&header, mapping_, sizeof(header));
+        try
+        {
+            size_ = details::checkColumnFileHeader<T>(header, mappingSize_, path);
+        }
+        catch (...)
+        {
+            ::munmap(mapping_, mappingSize_);
+            throw;
+        }
+        values_ = reinterpret_cast<T const*>(static_cast<unsigned char const*>(mapping_) + header.data_offset);
+    }
+
+    mapped_column(mapped_column&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, nullptr))
+        , mappingSize_(std::exchange(other.mappingSize_, 0))
+        , values_(std::exchange(other.values_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+    mapped_column& operator=(mapped_column&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            mappingSize_ = std::exchange(other.mappingSize_, 0);
+            values_ = std::exchange(other.values_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+    mapped_column(mapped_column const&) = delete;
+    mapped_column& operator=(mapped_column const&) = delete;
+
+    ~mapped_column()
+    {
+        unmap();
+    }
+
+    FLUENT_NODISCARD T const* data() const noexcept
+    {
+        return values_;
+    }
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return size_;
+    }
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+    FLUENT_NODISCARD T const& operator[](size_type position) const noexcept
+    {
+        FLUENT_ASSERT(position < size_);
+        return values_[position];
+    }
+    FLUENT_NODISCARD const_iterator begin() const noexcept
+    {
+        return values_;
+    }
+    FLUENT_NODISCARD const_iterator end() const noexcept
+    {
+        return values_ + size_;
+    }
+
+#    if defined(__cpp_lib_span)
+    FLUENT_NODISCARD std::span<T const> span() const noexcept
+    {
+        return {values_, size_};
+    }
+#    endif
+
+private:
+    void unmap() noexcept
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mappingSize_);
+        }
+    }
+
+    void* mapping_;
+    std::size_t mappingSize_;
+    T const* values_;
+    std::size_t size_;
+};
+
+#endif
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,519 @@
+#ifndef DECIMAL_HPP
+#define DECIMAL_HPP
+
+#include "checked_arithmetic.hpp"
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#if FLUENT_HOSTED == 1
+#    include <ostream>
+#endif
+
+#if FLUENT_CPP17_PRESENT
+#    include <charconv>
+#    include <system_error>
+#endif
+
+namespace fluent
+{
+
+// Fixed-point decimal number with Digits decimal places, stored as an integer count of 10^-Digits.
+// It has the operators of a number, so it can be wrapped in a NamedType with arithmetic skills:
+//
+//     using Price = NamedType<Decimal<int64_t, 4>, struct PriceTag, Addable, Subtractable, Comparable, Printable>;
+template <typename Rep, int Digits>
+class Decimal;
+
+namespace details
+{
+
+template <typename Rep>
+constexpr Rep powerOfTen(int exponent)
+{
+    Rep result = 1;
+    for (int i = 0; i < exponent; ++i)
+    {
+        result *= 10;
+    }
+    return result;
+}
+
+// Integer type that holds the product of two Reps, used to rescale multiplications and divisions.
+template <typename Rep, typename = void>
+struct WideRep
+{
+    using type = void;
+};
+
+template <typename Rep>
+struct WideRep<Rep, std::enable_if_t<(sizeof(Rep) < sizeof(std::int64_t))>>
+{
+    using type = std::conditional_t<std::is_signed<Rep>::value, std::int64_t, std::uint64_t>;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <typename Rep>
+struct WideRep<Rep, std::enable_if_t<sizeof(Rep) == sizeof(std::int64_t)>>
+{
+    __extension__ typedef __int128 SignedWide;
+    __extension__ typedef unsigned __int128 UnsignedWide;
+    using type = std::conditional_t<std::is_signed<Rep>::value, SignedWide, UnsignedWide>;
+};
+#endif
+
+template <typename Rep>
+using WideRepT = typename WideRep<Rep>::type;
+
+// Division rounding half away from zero. The signedness is passed explicitly because std::is_signed does not
+// recognize __int128 in strict standard modes.
+template <typename Integer>
+constexpr Integer roundedDivide(Integer numerator, Integer denominator, std::true_type /* is_signed */)
+{
+    Integer const quotient = numerator / denominator;
+    Integer const remainder = numerator % denominator;
+    Integer const twiceRemainder = remainder < 0 ? static_cast<Integer>(-remainder - remainder)
+                                                 : static_cast<Integer>(remainder + remainder);
+    Integer const absDenominator = denominator < 0 ? static_cast<Integer>(-denominator) : denominator;
+    if (twiceRemainder < absDenominator)
+    {
+        return quotient;
+    }
+    return (remainder < 0) != (denominator < 0) ? static_cast<Integer>(quotient - 1)
+                                                : static_cast<Integer>(quotient + 1);
+}
+
+template <typename Integer>
+constexpr Integer roundedDivide(Integer numerator, Integer denominator, std::false_type /* is_signed */)
+{
+    Integer const quotient = numerator / denominator;
+    Integer const remainder = numerator % denominator;
+    return remainder >= denominator - remainder ? static_cast<Integer>(quotient + 1u) : quotient;
+}
+
+// Computes a * b / c with rounding, through the wide type if there is one
+template <typename Rep>
+constexpr Rep scaledProduct(Rep a, Rep b, Rep c, std::true_type /* hasWideRep */)
+{
+    using Wide = WideRepT<Rep>;
+    return static_cast<Rep>(
+        roundedDivide(static_cast<Wide>(static_cast<Wide>(a) * b), static_cast<Wide>(c), std::is_signed<Rep>{}));
+}
+
+template <typename Rep>
+constexpr std::make_unsigned_t<Rep> magnitude(Rep value)
+{
+    using Unsigned = std::make_unsigned_t<Rep>;
+    return isNegative(value) ? static_cast<Unsigned>(0u - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+}
+
+// Without a wide type, the product of the magnitudes is computed on two Reps from their half words, and divided by
+// long division one bit at a time, so that a * b can exceed the range of Rep as long as a * b / c doesn't
+template <typename Rep>
+constexpr Rep scaledProduct(Rep a, Rep b, Rep c, std::false_type /* hasWideRep */)
+{
+    using Unsigned = std::make_unsigned_t<Rep>;
+    constexpr int digits = std::numeric_limits<Unsigned>::digits;
+    constexpr int halfDigits = digits / 2;
+    constexpr Unsigned halfMask = static_cast<Unsigned>((Unsigned{1} << halfDigits) - 1u);
+
+    Unsigned const ua = magnitude(a);
+    Unsigned const ub = magnitude(b);
+    Unsigned const uc = magnitude(c);
+    Unsigned const lowLow = static_cast<Unsigned>((ua & halfMask) * (ub & halfMask));
+    Unsigned const lowHigh = static_cast<Unsigned>((ua & halfMask) * (ub >> halfDigits));
+    Unsigned const highLow = static_cast<Unsigned>((ua >> halfDigits) * (ub & halfMask));
+    Unsigned const highHigh = static_cast<Unsigned>((ua >> halfDigits) * (ub >> halfDigits));
+    Unsigned const middle =
+        static_cast<Unsigned>((lowLow >> halfDigits) + (lowHigh & halfMask) + (highLow & halfMask));
+    Unsigned const low = static_cast<Unsigned>((lowLow & halfMask) | static_cast<Unsigned>(middle << halfDigits));
+    Unsigned const high = static_cast<Unsigned>(highHigh + (lowHigh >> halfDigits) + (highLow >> halfDigits)
+                                                + (middle >> halfDigits));
+
+    Unsigned quotient = 0;
+    Unsigned remainder = 0;
+    if (high == 0)
+    {
+        quotient = static_cast<Unsigned>(low / uc);
+        remainder = static_cast<Unsigned>(low % uc);
+    }
+    else
+    {
+        remainder = static_cast<Unsigned>(high % uc); // the quotient only fits in Rep if high < c
+        for (int bit = digits - 1; bit >= 0; --bit)
+        {
+            bool const carry = (remainder >> (digits - 1)) != 0;
+            remainder = static_cast<Unsigned>(static_cast<Unsigned>(remainder << 1) | ((low >> bit) & 1u));
+            quotient = static_cast<Unsigned>(quotient << 1);
+            if (carry || remainder >= uc)
+            {
+                remainder = static_cast<Unsigned>(remainder - uc);
+                quotient = static_cast<Unsigned>(quotient | 1u);
+            }
+        }
+    }
+    if (remainder >= uc - remainder)
+    {
+        quotient = static_cast<Unsigned>(quotient + 1u); // half away from zero
+    }
+    bool const negative = (isNegative(a) != isNegative(b)) != isNegative(c);
+    return static_cast<Rep>(negative ? static_cast<Unsigned>(0u - quotient) : quotient);
+}
+
+template <typename Rep>
+constexpr Rep scaledProduct(Rep a, Rep b, Rep c)
+{
+    return scaledProduct(a, b, c, std::integral_constant<bool, !std::is_void<WideRepT<Rep>>::value>{});
+}
+
+template <typename Rep, int Digits>
+struct DecimalFormat
+{
+    using Unsigned = std::make_unsigned_t<Rep>;
+    static constexpr std::size_t maxSize = std::numeric_limits<Unsigned>::digits10 + 1 + Digits + 3;
+
+    // Writes the decimal backwards, ending at bufferEnd, and returns its first character
+    static char* write(char* bufferEnd, Rep raw)
+    {
+        bool const negative = isNegative(raw);
+        Unsigned magnitude =
+            negative ? static_cast<Unsigned>(0u - static_cast<Unsigned>(raw)) : static_cast<Unsigned>(raw);
+        char* position = bufferEnd;
+        for (int i = 0; i < Digits; ++i)
+        {
+            *--position = static_cast<char>('0' + magnitude % 10u);
+            magnitude = static_cast<Unsigned>(magnitude / 10u);
+        }
+        if (Digits > 0)
+        {
+            *--position = '.';
+        }
+        do
+        {
+            *--position = static_cast<char>('0' + magnitude % 10u);
+            magnitude = static_cast<Unsigned>(magnitude / 10u);
+        } while (magnitude != 0);
+        if (negative)
+        {
+            *--position = '-';
+        }
+        return position;
+    }
+
+    enum class ParseStatus
+    {
+        ok,
+        invalid,
+        outOfRange
+    };
+
+    // Parses [-]digits[.digits], rounding the fractional digits that do not fit half away from zero
+    static ParseStatus parse(char const*& position, char const* last, Rep& raw)
+    {
+        bool const negative = position != last && *position == '-';
+        char const* current = negative ? position + 1 : position;
+        Unsigned magnitude = 0;
+        bool overflow = false;
+        bool anyDigit = false;
+        auto const isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        auto const accumulate = [&magnitude, &overflow](char c) {
+            overflow |= mulOverflow(magnitude, Unsigned{10}, magnitude);
+            overflow |= addOverflow(magnitude, static_cast<Unsigned>(c - '0'), magnitude);
+        };
+
+        for (; current != last && isDigit(*current); ++current)
+        {
+            accumulate(*current);
+            anyDigit = true;
+        }
+        int fractionalDigits = 0;
+        bool roundUp = false;
+        if (current != last && *current == '.')
+        {
+            char const* afterDot = current + 1;
+            for (current = afterDot; current != last && isDigit(*current); ++current)
+            {
+                if (fractionalDigits < Digits)
+                {
+                    accumulate(*current);
+                    ++fractionalDigits;
+                }
+                else if (current - afterDot == Digits)
+                {
+                    roundUp = *current >= '5';
+                }
+                anyDigit = true;
+            }
+        }
+        if (!anyDigit)
+        {
+            return ParseStatus::invalid;
+        }
+        for (; fractionalDigits < Digits; ++fractionalDigits)
+        {
+            accumulate('0');
+        }
+        if (roundUp)
+        {
+            overflow |= addOverflow(magnitude, Unsigned{1}, magnitude);
+        }
+
+        Unsigned const limit = negative
+                                   ? static_cast<Unsigned>(0u - static_cast<Unsigned>(std::numeric_limits<Rep>::min()))
+                                   : static_cast<Unsigned>(std::numeric_limits<Rep>::max());
+        position = current;
+        if (overflow || magnitude > limit)
+        {
+            return ParseStatus::outOfRange;
+        }
+        raw = negative ? static_cast<Rep>(0u - magnitude) : static_cast<Rep>(magnitude);
+        return ParseStatus::ok;
+    }
+};
+
+} // namespace details
+
+template <typename Rep, int Digits>
+class Decimal
+{
+public:
+    static_assert(std::is_integral<Rep>::value, "Decimal requires an integral representation");
+    static_assert(
+        Digits >= 0 && Digits <= std::numeric_limits<Rep>::digits10,
+        "Decimal has too many digits for its representation");
+
+    using rep = Rep;
+    static constexpr int digits = Digits;
+    static constexpr Rep scale = details::powerOfTen<Rep>(Digits);
+
+    Decimal() = default;
+
+    FLUENT_NODISCARD static constexpr Decimal fromRaw(Rep raw) noexcept
+    {
+        return Decimal(raw);
+    }
+
+    FLUENT_NODISCARD static constexpr Decimal fromUnits(Rep units) noexcept
+    {
+        return fromRaw(static_cast<Rep>(units * scale));
+    }
+
+    // Rounds half away from zero to the nearest representable value
+    FLUENT_NODISCARD static constexpr Decimal fromDouble(double value) noexcept
+    {
+        return fromRaw(static_cast<Rep>(value * static_cast<double>(scale) + (value < 0 ? -0.5 : 0.5)));
+    }
+
+    FLUENT_NODISCARD constexpr Rep raw() const noexcept
+    {
+        return raw_;
+    }
+
+    FLUENT_NODISCARD explicit constexpr operator double() const noexcept
+    {
+        return static_cast<double>(raw_) / static_cast<double>(scale);
+    }
+
+    // arithmetic
+    FLUENT_NODISCARD constexpr Decimal operator+(Decimal const& other) const noexcept
+    {
+        return fromRaw(static_cast<Rep>(raw_ + other.raw_));
+    }
+    FLUENT_NODISCARD constexpr Decimal operator+() const noexcept
+    {
+        return *this;
+    }
+    FLUENT_NODISCARD constexpr Decimal operator-(Decimal const& other) const noexcept
+    {
+        return fromRaw(static_cast<Rep>(raw_ - other.raw_));
+    }
+    FLUENT_NODISCARD constexpr Decimal operator-() const noexcept
+    {
+        return fromRaw(static_cast<Rep>(-raw_));
+    }
+    // Products and quotients are rescaled in integer arithmetic, rounding half away from zero
+    FLUENT_NODISCARD constexpr Decimal operator*(Decimal const& other) const noexcept
+    {
+        return fromRaw(details::scaledProduct(raw_, other.raw_, scale));
+    }
+    FLUENT_NODISCARD constexpr Decimal operator/(Decimal const& other) const noexcept
+    {
+        return fromRaw(details::scaledProduct(raw_, scale, other.raw_));
+    }
+    FLUENT_NODISCARD constexpr Decimal operator%(Decimal const& other) const noexcept
+    {
+        return fromRaw(static_cast<Rep>(raw_ % other.raw_));
+    }
+
+    FLUENT_CONSTEXPR17 Decimal& operator+=(Decimal const& other) noexcept
+    {
+        return *this = *this + other;
+    }
+    FLUENT_CONSTEXPR17 Decimal& operator-=(Decimal const& other) noexcept
+    {
+        return *this = *this - other;
+    }
+    FLUENT_CONSTEXPR17 Decimal& operator*=(Decimal const& other) noexcept
+    {
+        return *this = *this * other;
+    }
+    FLUENT_CONSTEXPR17 Decimal& operator/=(Decimal const& other) noexcept
+    {
+        return *this = *this / other;
+    }
+    FLUENT_CONSTEXPR17 Decimal& operator%=(Decimal const& other) noexcept
+    {
+        return *this = *this % other;
+    }
+
+    // Increments and decrements add or remove one unit
+    FLUENT_CONSTEXPR17 Decimal& operator++() noexcept
+    {
+        raw_ = static_cast<Rep>(raw_ + scale);
+        return *this;
+    }
+    FLUENT_CONSTEXPR17 Decimal operator++(int) noexcept
+    {
+        Decimal const old = *this;
+        ++*this;
+        return old;
+    }
+    FLUENT_CONSTEXPR17 Decimal& operator--() noexcept
+    {
+        raw_ = static_cast<Rep>(raw_ - scale);
+        return *this;
+    }
+    FLUENT_CONSTEXPR17 Decimal operator--(int) noexcept
+    {
+        Decimal const old = *this;
+        --*this;
+        return old;
+    }
+
+    // comparison
+    FLUENT_NODISCARD friend constexpr bool operator==(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ == rhs.raw_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ != rhs.raw_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ < rhs.raw_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ > rhs.raw_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<=(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ <= rhs.raw_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>=(Decimal const& lhs, Decimal const& rhs) noexcept
+    {
+        return lhs.raw_ >= rhs.raw_;
+    }
+
+private:
+    explicit constexpr Decimal(Rep raw) noexcept : raw_(raw)
+    {
+    }
+
+    Rep raw_;
+};
+
+template <typename Rep, int Digits>
+constexpr Rep Decimal<Rep, Digits>::scale;
+
+template <typename Rep, int Digits>
+constexpr int Decimal<Rep, Digits>::digits;
+
+// Converts between scales, rounding half away from zero when digits are dropped
+template <typename ToDecimal, typename Rep, int Digits>
+FLUENT_NODISCARD constexpr ToDecimal decimal_cast(Decimal<Rep, Digits> const& value)
+{
+    using ToRep = typename ToDecimal::rep;
+    using CommonRep = std::common_type_t<Rep, ToRep>;
+    return ToDecimal::digits >= Digits
+               ? ToDecimal::fromRaw(static_cast<ToRep>(
+                     static_cast<CommonRep>(value.raw()) * details::powerOfTen<CommonRep>(ToDecimal::digits - Digits)))
+               : ToDecimal::fromRaw(static_cast<ToRep>(details::roundedDivide(
+                     static_cast<CommonRep>(value.raw()),
+                     details::powerOfTen<CommonRep>(Digits - ToDecimal::digits),
+                     std::is_signed<CommonRep>{})));
+}
+
+#if FLUENT_HOSTED == 1
+template <typename Rep, int Digits>
+std::ostream& operator<<(std::ostream& os, Decimal<Rep, Digits> const& value)
+{
+    char buffer[details::DecimalFormat<Rep, Digits>::maxSize];
+    char* const bufferEnd = buffer + sizeof(buffer);
+    char* const first = details::DecimalFormat<Rep, Digits>::write(bufferEnd, value.raw());
+    return os.write(first, bufferEnd - first);
+}
+#endif
+
+#if FLUENT_CPP17_PRESENT
+// Writes all the decimal places, without exponent: Decimal<int64_t, 2>::fromRaw(-5) is written "-0.05"
+template <typename Rep, int Digits>
+std::to_chars_result to_chars(char* first, char* last, Decimal<Rep, Digits> const& value)
+{
+    char buffer[details::DecimalFormat<Rep, Digits>::maxSize];
+    char* const bufferEnd = buffer + sizeof(buffer);
+    char* const begin = details::DecimalFormat<Rep, Digits>::write(bufferEnd, value.raw());
+    auto const size = bufferEnd - begin;
+    if (last - first < size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+    for (char const* source = begin; source != bufferEnd; ++source, ++first)
+    {
+        *first = *source;
+    }
+    return {first, std::errc{}};
+}
+
+// Reads [-]digits[.digits]. Decimal places beyond Digits are rounded half away from zero.
+template <typename Rep, int Digits>
+std::from_chars_result from_chars(char const* first, char const* last, Decimal<Rep, Digits>& value)
+{
+    using Format = details::DecimalFormat<Rep, Digits>;
+    char const* position = first;
+    Rep raw = 0;
+    switch (Format::parse(position, last, raw))
+    {
+        case Format::ParseStatus::invalid:
+            return {first, std::errc::invalid_argument};
+        case Format::ParseStatus::outOfRange:
+            return {position, std::errc::result_out_of_range};
+        case Format::ParseStatus::ok:
+            break;
+    }
+    value = Decimal<Rep, Digits>::fromRaw(raw);
+    return {position, std::errc{}};
+}
+#endif
+
+} // namespace fluent
+
+namespace std
+{
+template <typename Rep, int Digits>
+struct hash<fluent::Decimal<Rep, Digits>>
+{
+    size_t operator()(fluent::Decimal<Rep, Digits> const& x) const noexcept
+    {
+        return std::hash<Rep>()(x.raw());
+    }
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef DELTA_COLUMN_HPP
+#define DELTA_COLUMN_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace fluent
+{
+
+// Column of values of a strong integer type, such as timestamps or sequence numbers, compressed by blocks of
+// BlockSize values. Each block stores its smallest value, and the difference of each of its values to it packed on as
+// few bits as the largest difference needs. Sorted columns of close values, whose blocks span small ranges, take a few
+// bits per value instead of 8 bytes, while any value can still be read directly.
+// Values are appended to an uncompressed block, that is compressed once full.
+template <typename Strong, std::size_t BlockSize = 128>
+class delta_column
+{
+    using Underlying = std::remove_reference_t<typename Strong::UnderlyingType>;
+    static_assert(std::is_integral<Underlying>::value, "delta_column requires an integral underlying type");
+    static_assert(BlockSize > 0, "blocks hold at least one value");
+
+public:
+    using value_type = Strong;
+    using size_type = std::size_t;
+
+    static constexpr size_type block_size = BlockSize;
+
+    delta_column() : blocks_(), words_(), pending_()
+    {
+    }
+
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return blocks_.size() * BlockSize + pending_.size();
+    }
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void push_back(Strong const& value)
+    {
+        if (pending_.empty())
+        {
+            pending_.reserve(BlockSize);
+        }
+        pending_.push_back(toBits(value.get()));
+        if (pending_.size() == BlockSize)
+        {
+            compressPending();
+        }
+    }
+
+    void clear() noexcept
+    {
+        blocks_.clear();
+        words_.clear();
+        pending_.clear();
+    }
+
+    // Values are decoded on each access, so they are returned by value
+    FLUENT_NODISCARD Strong operator[](size_type position) const noexcept
+    {
+        FLUENT_ASSERT(position < size());
+        size_type const block = position / BlockSize;
+        if (block == blocks_.size())
+        {
+            return fromBits(pending_[position % BlockSize]);
+        }
+        return fromBits(blocks_[block].reference + unpack(blocks_[block], position % BlockSize));
+    }
+    FLUENT_NODISCARD Strong at(size_type position) const
+    {
+        if (position >= size())
+        {
+            throw std::out_of_range("fluent::delta_column::at: position out of range");
+        }
+        return (*this)[position];
+    }
+
+    // Blocks, the last one holding fewer than BlockSize values if the size is not a multiple of BlockSize
+    FLUENT_NODISCARD size_type block_count() const noexcept
+    {
+        return blocks_.size() + (pending_.empty() ? 0 : 1);
+    }
+
+    // Decodes the values of a block in values, that has room for BlockSize values, and returns their number
+    size_type decode_block(size_type block, Strong* values) const
+    {
+        FLUENT_ASSERT(block < block_count());
+        if (block == blocks_.size())
+        {
+            for (size_type i = 0; i < pending_.size(); ++i)
+            {
+                values[i] = fromBits(pending_[i]);
+            }
+            return pending_.size();
+        }
+        Block const& packed = blocks_[block];
+        for (size_type i = 0; i < BlockSize; ++i)
+        {
+            values[i] = fromBits(packed.reference + unpack(packed, i));
+        }
+        return BlockSize;
+    }
+
+    // Sequential scan, decoding one block at a time
+    template <typename Function>
+    void for_each(Function&& function) const
+    {
+        for (Block const& packed : blocks_)
+        {
+            for (size_type i = 0; i < BlockSize; ++i)
+            {
+                function(fromBits(packed.reference + unpack(packed, i)));
+            }
+        }
+        for (Bits const bits : pending_)
+        {
+            function(fromBits(bits));
+        }
+    }
+
+    // Number of bytes used to store the values, to compare with size() * sizeof(Strong)
+    FLUENT_NODISCARD size_type compressed_size() const noexcept
+    {
+        return blocks_.size() * sizeof(Block) + words_.size() * sizeof(Word) + pending_.size() * sizeof(Bits);
+    }
+
+private:
+    using Bits = std::uint64_t;
+    using Word = std::uint64_t;
+    static constexpr unsigned wordBits = 64;
+
+    struct Block
+    {
+        Bits reference;
+        size_type firstWord;
+        unsigned width;
+    };
+
+    // Integers are stored as unsigned bits, on which differences wrap around
+    static Bits toBits(Underlying value) noexcept
+    {
+        using Wide = std::conditional_t<std::is_signed<Underlying>::value, std::int64_t, Bits>;
+        return static_cast<Bits>(static_cast<Wide>(value));
+    }
+    static Strong fromBits(Bits bits) noexcept
+    {
+        return Strong(static_cast<Underlying>(bits));
+    }
+
+    static Bits lowMask(unsigned width) noexcept
+    {
+        return width >= wordBits ? ~Bits{0} : (Bits{1} << width) - 1;
+    }
+
+    Bits unpack(Block const& block, size_type index) const noexcept
+    {
+        if (block.width == 0)
+        {
+            return 0;
+        }
+        size_type const bit = index * block.width;
+        size_type const word = block.firstWord + bit / wordBits;
+        unsigned const shift = static_cast<unsigned>(bit % wordBits);
+        Bits bits = words_[word] >> shift;
+        if (shift + block.width > wordBits)
+        {
+            bits |= words_[word + 1] << (wordBits - shift);
+        }
+        return bits & lowMask(block.width);
+    }
+
+    void compressPending()
+    {
+        Bits reference = pending_[0];
+        for (Bits const bits : pending_)
+        {
+            if (isLess(bits, reference))
+            {
+                reference = bits;
+            }
+        }
+        Bits largestDifference = 0;
+        for (Bits const bits : pending_)
+        {
+            largestDifference |= bits - reference;
+        }
+        unsigned width = 0;
+        while (width < wordBits && (largestDifference >> width) != 0)
+        {
+            ++width;
+        }
+
+        Block const block = {reference, words_.size(), width};
+        words_.resize(words_.size() + (BlockSize * width + wordBits - 1) / wordBits, 0);
+        for (size_type i = 0; i < BlockSize && width > 0; ++i)
+        {
+            Bits const difference = pending_[i] - reference;
+            size_type const bit = i * width;
+            size_type const word = block.firstWord + bit / wordBits;
+            unsigned const shift = static_cast<unsigned>(bit % wordBits);
+            words_[word] |= difference << shift;
+            if (shift + width > wordBits)
+            {
+                words_[word + 1] |= difference >> (wordBits - shift);
+            }
+        }
+        blocks_.push_back(block);
+        pending_.clear();
+    }
+
+    // Order of the values of the underlying type
+    static bool isLess(Bits lhs, Bits rhs) noexcept
+    {
+        return std::is_signed<Underlying>::value ? static_cast<std::int64_t>(lhs) < static_cast<std::int64_t>(rhs)
+                                                 : lhs < rhs;
+    }
+
+    std::vector<Block> blocks_;
+    std::vector<Word> words_;
+    std::vector<Bits> pending_;
+};
+
+} // namespace fluent
+
+#endif
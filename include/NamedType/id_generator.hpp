@@ -0,0 +1,82 @@
+#ifndef ID_GENERATOR_HPP
+#define ID_GENERATOR_HPP
+
+#include "cache_aligned.hpp"
+#include "named_type_impl.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fluent
+{
+
+namespace details
+{
+
+// Counter shared by the id_generators of Id, whatever their block size. It is aligned and padded to whole cache lines,
+// so that taking a block does not slow down the threads accessing neighbouring variables.
+template <typename Id>
+struct alignas(cache_line_size) IdCounter
+{
+    static IdCounter instance;
+
+    std::atomic<std::remove_reference_t<typename Id::UnderlyingType>> value;
+};
+
+template <typename Id>
+IdCounter<Id> IdCounter<Id>::instance{};
+
+} // namespace details
+
+// Generator of unique values of the strong type Id, shared by all the threads of the program.
+// Each thread takes blocks of BlockSize consecutive values from a shared atomic counter, and generates the values of
+// its current block without synchronization, so threads only touch the shared counter once every BlockSize values.
+// The values generated by a thread are increasing. Across threads they are not: a thread can generate a value lower
+// than one generated before by another thread. With a BlockSize of 1, values are increasing across threads too, at the
+// cost of an atomic increment per value.
+// The values left in the block of a thread are lost when the thread exits.
+// All the id_generators of Id share the same counter, so generators with different block sizes don't return the same
+// values.
+template <typename Id, std::size_t BlockSize = 1024>
+class id_generator
+{
+public:
+    using underlying_type = std::remove_reference_t<typename Id::UnderlyingType>;
+    static_assert(std::is_integral<underlying_type>::value, "id_generator requires an integral underlying type");
+    static_assert(BlockSize > 0, "blocks contain at least one value");
+    static_assert(BlockSize <= static_cast<std::uintmax_t>(std::numeric_limits<underlying_type>::max()),
+                  "blocks must fit in the underlying type");
+
+    FLUENT_NODISCARD static Id next() noexcept
+    {
+        thread_local Block block = {underlying_type{}, underlying_type{}};
+        if (block.next == block.end)
+        {
+            block.next = details::IdCounter<Id>::instance.value.fetch_add(
+                static_cast<underlying_type>(BlockSize), std::memory_order_relaxed);
+            block.end = static_cast<underlying_type>(block.next + BlockSize);
+        }
+        return Id(block.next++);
+    }
+
+private:
+    struct Block
+    {
+        underlying_type next;
+        underlying_type end;
+    };
+};
+
+// A new value of Id, unique in the program
+template <typename Id>
+FLUENT_NODISCARD Id next_id() noexcept
+{
+    return id_generator<Id>::next();
+}
+
+} // namespace fluent
+
+#endif
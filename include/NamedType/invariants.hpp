@@ -0,0 +1,172 @@
+#ifndef INVARIANTS_HPP
+#define INVARIANTS_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// Tell the optimizer that a pointer is aligned, without checking it
+#if defined(__clang__) || defined(__GNUC__)
+#    define FLUENT_ASSUME_ALIGNED(pointer, alignment) __builtin_assume_aligned((pointer), (alignment))
+#else
+#    define FLUENT_ASSUME_ALIGNED(pointer, alignment) (pointer)
+#endif
+
+// Skills that check a property of the value when the strong type is constructed, throwing std::invalid_argument if it
+// does not hold, and let the compiler rely on this property afterwards. Strong types with these skills can't be default
+// constructed. Their values must not be modified through get() or through skills such as Addable, that would bypass
+// the check.
+
+namespace fluent
+{
+
+namespace details
+{
+
+template <typename U>
+constexpr bool isPowerOfTwo(U value)
+{
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+template <typename U>
+constexpr int log2OfPowerOfTwo(U value)
+{
+#if defined(__clang__) || defined(__GNUC__)
+    return __builtin_ctzll(static_cast<unsigned long long>(value));
+#else
+    int exponent = 0;
+    while ((value >>= 1) != 0)
+    {
+        ++exponent;
+    }
+    return exponent;
+#endif
+}
+
+template <typename U>
+using IfIntegral = std::enable_if_t<std::is_integral<U>::value>;
+
+template <typename U, typename Strong>
+using IfUnsignedAtLeastAsWide = std::enable_if_t<
+    std::is_unsigned<U>::value
+    && std::numeric_limits<U>::digits
+           >= std::numeric_limits<std::remove_reference_t<typename Strong::UnderlyingType>>::digits>;
+
+} // namespace details
+
+template <typename T>
+struct NonZero : crtp<T, NonZero>
+{
+    template <typename U>
+    static constexpr void checkInvariant(U const& value)
+    {
+        if (value == U{})
+        {
+            throw std::invalid_argument("fluent::NonZero: value is zero");
+        }
+    }
+
+    // Division of an integer by the strong type
+    template <typename U, typename = details::IfIntegral<U>>
+    FLUENT_NODISCARD friend constexpr U operator/(U const& dividend, T const& divisor)
+    {
+        FLUENT_ASSUME(divisor.get() != U{});
+        return static_cast<U>(dividend / divisor.get());
+    }
+    template <typename U, typename = details::IfIntegral<U>>
+    FLUENT_NODISCARD friend constexpr U operator%(U const& dividend, T const& divisor)
+    {
+        FLUENT_ASSUME(divisor.get() != U{});
+        return static_cast<U>(dividend % divisor.get());
+    }
+};
+
+// For unsigned underlying types: divisions become shifts, and modulos become masks
+template <typename T>
+struct PowerOfTwo : crtp<T, PowerOfTwo>
+{
+    template <typename U>
+    static constexpr void checkInvariant(U const& value)
+    {
+        static_assert(std::is_unsigned<U>::value, "PowerOfTwo requires an unsigned underlying type");
+        if (!details::isPowerOfTwo(value))
+        {
+            throw std::invalid_argument("fluent::PowerOfTwo: value is not a power of two");
+        }
+    }
+
+    FLUENT_NODISCARD constexpr int log2() const
+    {
+        return details::log2OfPowerOfTwo(this->underlying().get());
+    }
+
+    // Division of an unsigned integer by the strong type. Signed dividends are not supported as shifting them rounds
+    // towards minus infinity, and narrower ones as the shift could be as wide as them.
+    template <typename U, typename Strong = T, typename = details::IfUnsignedAtLeastAsWide<U, Strong>>
+    FLUENT_NODISCARD friend constexpr U operator/(U const& dividend, T const& divisor)
+    {
+        return static_cast<U>(dividend >> divisor.log2());
+    }
+    template <typename U, typename Strong = T, typename = details::IfUnsignedAtLeastAsWide<U, Strong>>
+    FLUENT_NODISCARD friend constexpr U operator%(U const& dividend, T const& divisor)
+    {
+        return static_cast<U>(dividend & (divisor.get() - 1u));
+    }
+};
+
+// For integers multiple of Alignment, or pointers aligned on Alignment bytes
+template <std::size_t Alignment>
+struct Aligned
+{
+    static_assert(details::isPowerOfTwo(Alignment), "alignments are powers of two");
+
+    template <typename T>
+    struct templ : crtp<T, templ>
+    {
+        template <typename U, typename = details::IfIntegral<U>>
+        static constexpr void checkInvariant(U const& value)
+        {
+            if (value % Alignment != 0)
+            {
+                throw std::invalid_argument("fluent::Aligned: value is not aligned");
+            }
+        }
+        template <typename U>
+        static void checkInvariant(U* const& pointer)
+        {
+            if (reinterpret_cast<std::uintptr_t>(pointer) % Alignment != 0)
+            {
+                throw std::invalid_argument("fluent::Aligned: pointer is not aligned");
+            }
+        }
+
+        // The value, known by the compiler to be aligned
+        FLUENT_NODISCARD constexpr auto aligned() const
+        {
+            return aligned(this->underlying().get());
+        }
+
+    private:
+        template <typename U, typename = details::IfIntegral<U>>
+        static constexpr U aligned(U value)
+        {
+            FLUENT_ASSUME(value % Alignment == 0);
+            return value;
+        }
+        template <typename U>
+        static U* aligned(U* pointer)
+        {
+            return static_cast<U*>(FLUENT_ASSUME_ALIGNED(pointer, Alignment));
+        }
+    };
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef IOTA_HPP
+#define IOTA_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Range of consecutive values of a strong type over an integral type, from first included to last excluded.
+// Its iterators hold the underlying value and compare it directly, without going through the skills of the strong type,
+// so that loops over the range compile like loops over raw integers.
+template <typename Strong>
+class iota_range
+{
+public:
+    using underlying_type = std::remove_reference_t<typename Strong::UnderlyingType>;
+    static_assert(std::is_integral<underlying_type>::value, "iota_range requires an integral underlying type");
+
+    class iterator
+    {
+    public:
+        // Dereferencing returns a value instead of a reference, which only input iterators may do before C++20
+        using iterator_category = std::input_iterator_tag;
+#if defined(__cpp_lib_ranges)
+        using iterator_concept = std::random_access_iterator_tag;
+#endif
+        using value_type = Strong;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Strong;
+
+        constexpr iterator() noexcept : value_()
+        {
+        }
+        explicit constexpr iterator(underlying_type value) noexcept : value_(value)
+        {
+        }
+
+        FLUENT_NODISCARD constexpr Strong operator*() const
+        {
+            return Strong(value_);
+        }
+        FLUENT_NODISCARD constexpr Strong operator[](difference_type offset) const
+        {
+            return Strong(advanced(value_, offset));
+        }
+
+        FLUENT_CONSTEXPR17 iterator& operator++() noexcept
+        {
+            ++value_;
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 iterator operator++(int) noexcept
+        {
+            iterator const old = *this;
+            ++value_;
+            return old;
+        }
+        FLUENT_CONSTEXPR17 iterator& operator--() noexcept
+        {
+            --value_;
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 iterator operator--(int) noexcept
+        {
+            iterator const old = *this;
+            --value_;
+            return old;
+        }
+        FLUENT_CONSTEXPR17 iterator& operator+=(difference_type offset) noexcept
+        {
+            value_ = advanced(value_, offset);
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 iterator& operator-=(difference_type offset) noexcept
+        {
+            value_ = advanced(value_, -offset);
+            return *this;
+        }
+        FLUENT_NODISCARD friend constexpr iterator operator+(iterator it, difference_type offset) noexcept
+        {
+            return iterator(advanced(it.value_, offset));
+        }
+        FLUENT_NODISCARD friend constexpr iterator operator+(difference_type offset, iterator it) noexcept
+        {
+            return iterator(advanced(it.value_, offset));
+        }
+        FLUENT_NODISCARD friend constexpr iterator operator-(iterator it, difference_type offset) noexcept
+        {
+            return iterator(advanced(it.value_, -offset));
+        }
+        FLUENT_NODISCARD friend constexpr difference_type operator-(iterator lhs, iterator rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.value_) - static_cast<difference_type>(rhs.value_);
+        }
+
+        FLUENT_NODISCARD friend constexpr bool operator==(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ == rhs.value_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator!=(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ != rhs.value_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator<(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ < rhs.value_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator>(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ > rhs.value_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator<=(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ <= rhs.value_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator>=(iterator lhs, iterator rhs) noexcept
+        {
+            return lhs.value_ >= rhs.value_;
+        }
+
+    private:
+        static constexpr underlying_type advanced(underlying_type value, difference_type offset) noexcept
+        {
+            return static_cast<underlying_type>(static_cast<difference_type>(value) + offset);
+        }
+
+        underlying_type value_;
+    };
+
+    using const_iterator = iterator;
+
+    constexpr iota_range(Strong const& first, Strong const& last) noexcept : first_(first.get()), last_(last.get())
+    {
+    }
+
+    FLUENT_NODISCARD constexpr iterator begin() const noexcept
+    {
+        return iterator(first_);
+    }
+    FLUENT_NODISCARD constexpr iterator end() const noexcept
+    {
+        return iterator(last_);
+    }
+    FLUENT_NODISCARD constexpr std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(last_ - first_);
+    }
+    FLUENT_NODISCARD constexpr bool empty() const noexcept
+    {
+        return first_ == last_;
+    }
+
+private:
+    underlying_type first_;
+    underlying_type last_;
+};
+
+// The values of Strong from first to last, last excluded
+template <typename Strong>
+FLUENT_NODISCARD constexpr iota_range<Strong> iota(Strong const& first, Strong const& last) noexcept
+{
+    return iota_range<Strong>(first, last);
+}
+
+// The count values of Strong starting from first
+template <typename Strong>
+FLUENT_NODISCARD constexpr iota_range<Strong> iota_n(Strong const& first, std::size_t count) noexcept
+{
+    using Underlying = typename iota_range<Strong>::underlying_type;
+    return iota_range<Strong>(first, Strong(static_cast<Underlying>(first.get() + count)));
+}
+
+} // namespace fluent
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef NAMED_TYPE_HPP
 #define NAMED_TYPE_HPP
 
+#include "cache_aligned.hpp"
+#include "checked_arithmetic.hpp"
+#include "invariants.hpp"
 #include "named_type_impl.hpp"
+#include "serial_number.hpp"
 #include "underlying_functionalities.hpp"
 #include "version.hpp"
 
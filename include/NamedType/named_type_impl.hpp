@@ -1,6 +1,9 @@
 #ifndef named_type_impl_h
 #define named_type_impl_h
 
+#include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -38,6 +41,27 @@
 #    define FLUENT_EBCO
 #endif
 
+// Tell the optimizer that a condition holds, without checking it
+#if defined(__clang__)
+#    define FLUENT_ASSUME(condition) __builtin_assume(condition)
+#elif defined(__GNUC__)
+#    define FLUENT_ASSUME(condition)                                                                                   \
+        do                                                                                                             \
+        {                                                                                                              \
+            if (!(condition))                                                                                          \
+                __builtin_unreachable();                                                                               \
+        } while (false)
+#elif defined(_MSC_VER)
+#    define FLUENT_ASSUME(condition) __assume(condition)
+#else
+#    define FLUENT_ASSUME(condition) static_cast<void>(0)
+#endif
+
+// Checks of unchecked accesses, compiled out with NDEBUG like assert
+#ifndef FLUENT_ASSERT
+#    define FLUENT_ASSERT(condition) assert(condition)
+#endif
+
 #if defined(__clang__) || defined(__GNUC__)
 #   define IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN                                                                \
     _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Weffc++\"")
@@ -53,8 +77,126 @@ namespace fluent
 template <typename T>
 using IsNotReference = typename std::enable_if<!std::is_reference<T>::value, void>::type;
 
+namespace details
+{
+template <typename... Ts>
+struct MakeVoid
+{
+    using type = void;
+};
+
+template <typename T, typename... Ts>
+struct CountOf : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T, typename Head, typename... Tail>
+struct CountOf<T, Head, Tail...>
+    : std::integral_constant<std::size_t, (std::is_same<T, Head>::value ? 1 : 0) + CountOf<T, Tail...>::value>
+{
+};
+
+template <typename... Ts>
+struct AreDistinct : std::true_type
+{
+};
+
+template <typename Head, typename... Tail>
+struct AreDistinct<Head, Tail...>
+    : std::integral_constant<bool, CountOf<Head, Tail...>::value == 0 && AreDistinct<Tail...>::value>
+{
+};
+
+template <bool... Conditions>
+using AllOf =
+    std::is_same<std::integer_sequence<bool, true, Conditions...>, std::integer_sequence<bool, Conditions..., true>>;
+
+// Copy of a trivially copyable T from the bytes of a T, that doesn't require T to be default constructible, as strong
+// types with invariants are not. Copying the bytes into the storage of the union member implicitly creates the value.
+template <typename T>
+T fromBytes(void const* bytes) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be copied from bytes");
+    union Storage
+    {
+        Storage() noexcept : raw()
+        {
+        }
+        unsigned char raw[sizeof(T)];
+        T value;
+    } storage;
+    std::memcpy(&storage.value, bytes, sizeof(T));
+    return storage.value;
+}
+
+// Skills can constrain the values of a strong type by defining a static checkInvariant(value) function,
+// that NamedType calls on construction.
+template <typename Skill, typename Value, typename = void>
+struct SkillInvariant
+{
+    static constexpr bool isChecked = false;
+    static constexpr bool isNothrow = true;
+    static constexpr void check(Value const&) noexcept
+    {
+    }
+};
+
+template <typename Skill, typename Value>
+struct SkillInvariant<
+    Skill,
+    Value,
+    typename MakeVoid<decltype(Skill::checkInvariant(std::declval<Value const&>()))>::type>
+{
+    static constexpr bool isChecked = true;
+    static constexpr bool isNothrow = noexcept(Skill::checkInvariant(std::declval<Value const&>()));
+    static constexpr void check(Value const& value) noexcept(isNothrow)
+    {
+        Skill::checkInvariant(value);
+    }
+};
+
+template <typename Value, typename... Skills>
+struct Invariants
+{
+    static constexpr bool isChecked = !AllOf<!SkillInvariant<Skills, Value>::isChecked...>::value;
+    static constexpr bool isNothrow = std::is_same<
+        std::integer_sequence<bool, true, SkillInvariant<Skills, Value>::isNothrow...>,
+        std::integer_sequence<bool, SkillInvariant<Skills, Value>::isNothrow..., true>>::value;
+
+    static constexpr void check(Value const& value) noexcept(isNothrow)
+    {
+        using expand = int[];
+        static_cast<void>(expand{0, (SkillInvariant<Skills, Value>::check(value), 0)...});
+    }
+};
+// Base of NamedType that deletes its default constructor when its skills check invariants, as the default value of
+// the underlying type would not be checked. It is keyed on the NamedType, so that a NamedType over another NamedType
+// doesn't hold two subobjects of the same empty type, which would prevent the empty base optimization.
+template <bool IsDefaultConstructible, typename Owner>
+struct DefaultConstruction
+{
+    DefaultConstruction() = default;
+    constexpr explicit DefaultConstruction(int) noexcept
+    {
+    }
+};
+
+template <typename Owner>
+struct DefaultConstruction<false, Owner>
+{
+    DefaultConstruction() = delete;
+    constexpr explicit DefaultConstruction(int) noexcept
+    {
+    }
+};
+} // namespace details
+
 template <typename T, typename Parameter, template <typename> class... Skills>
-class FLUENT_EBCO NamedType : public Skills<NamedType<T, Parameter, Skills...>>...
+class FLUENT_EBCO NamedType
+    : public Skills<NamedType<T, Parameter, Skills...>>...
+    , private details::DefaultConstruction<
+          !details::Invariants<std::remove_reference_t<T>, Skills<NamedType<T, Parameter, Skills...>>...>::isChecked,
+          NamedType<T, Parameter, Skills...>>
 {
 public:
     using UnderlyingType = T;
@@ -62,17 +204,24 @@ public:
     // constructor
     NamedType()  = default;
 
-    explicit constexpr NamedType(T const& value) noexcept(std::is_nothrow_copy_constructible<T>::value) : value_(value)
+    explicit constexpr NamedType(T const& value) noexcept(
+        std::is_nothrow_copy_constructible<T>::value && Invariants::isNothrow)
+        : DefaultConstruction(0), value_(value)
     {
+        Invariants::check(value_);
     }
 
     template <typename T_ = T, typename = IsNotReference<T_>>
-    explicit constexpr NamedType(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value)
-        : value_(std::move(value))
+    explicit constexpr NamedType(T&& value) noexcept(
+        std::is_nothrow_move_constructible<T>::value && Invariants::isNothrow)
+        : DefaultConstruction(0), value_(std::move(value))
     {
+        Invariants::check(value_);
     }
 
     // get
+    // Invariants are only checked on construction: modifying the value through get(), or through skills that modify
+    // it such as Addable's operator+=, can break them.
     FLUENT_NODISCARD constexpr T& get() noexcept
     {
         return value_;
@@ -118,6 +267,9 @@ public:
     };
 
 private:
+    using Invariants = details::Invariants<std::remove_reference_t<T>, Skills<NamedType>...>;
+    using DefaultConstruction = details::DefaultConstruction<!Invariants::isChecked, NamedType>;
+
     T value_;
 };
 
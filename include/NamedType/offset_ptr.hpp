@@ -0,0 +1,197 @@
+#ifndef OFFSET_PTR_HPP
+#define OFFSET_PTR_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Pointer to a T inside a memory region identified by Tag, stored as its offset in bytes from the start of the region.
+// Unlike raw pointers, offset_ptrs stay valid when the region is mapped at another address, so they can be stored in
+// memory-mapped files or shared memory. They can only be dereferenced through a region with the same Tag, and pointer
+// arithmetic only combines offset_ptrs to the same type in the same region.
+// The largest value of Offset represents the null offset_ptr.
+template <typename T, typename Tag, typename Offset = std::uint32_t>
+class offset_ptr
+{
+    static_assert(std::is_unsigned<Offset>::value, "offset_ptr requires an unsigned offset type");
+
+public:
+    using element_type = T;
+    using offset_type = Offset;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr offset_ptr() noexcept : offset_(null)
+    {
+    }
+    constexpr offset_ptr(std::nullptr_t) noexcept : offset_(null)
+    {
+    }
+    // Pointer to const from pointer to non-const
+    template <typename U, typename = std::enable_if_t<std::is_same<T, U const>::value && !std::is_const<U>::value>>
+    constexpr offset_ptr(offset_ptr<U, Tag, Offset> const& other) noexcept : offset_(other.raw())
+    {
+    }
+
+    // Offset in bytes from the start of the region
+    FLUENT_NODISCARD static constexpr offset_ptr fromRaw(Offset offset) noexcept
+    {
+        return offset_ptr(offset, RawTag{});
+    }
+    FLUENT_NODISCARD constexpr Offset raw() const noexcept
+    {
+        return offset_;
+    }
+    FLUENT_NODISCARD explicit constexpr operator bool() const noexcept
+    {
+        return offset_ != null;
+    }
+
+    // arithmetic, in number of T
+    FLUENT_CONSTEXPR17 offset_ptr& operator+=(difference_type count) noexcept
+    {
+        offset_ = static_cast<Offset>(static_cast<difference_type>(offset_) + count * elementSize);
+        return *this;
+    }
+    FLUENT_CONSTEXPR17 offset_ptr& operator-=(difference_type count) noexcept
+    {
+        offset_ = static_cast<Offset>(static_cast<difference_type>(offset_) - count * elementSize);
+        return *this;
+    }
+    FLUENT_CONSTEXPR17 offset_ptr& operator++() noexcept
+    {
+        return *this += 1;
+    }
+    FLUENT_CONSTEXPR17 offset_ptr& operator--() noexcept
+    {
+        return *this -= 1;
+    }
+    FLUENT_NODISCARD friend constexpr offset_ptr operator+(offset_ptr pointer, difference_type count) noexcept
+    {
+        return fromRaw(static_cast<Offset>(static_cast<difference_type>(pointer.offset_) + count * elementSize));
+    }
+    FLUENT_NODISCARD friend constexpr offset_ptr operator-(offset_ptr pointer, difference_type count) noexcept
+    {
+        return fromRaw(static_cast<Offset>(static_cast<difference_type>(pointer.offset_) - count * elementSize));
+    }
+    FLUENT_NODISCARD friend constexpr difference_type operator-(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return (static_cast<difference_type>(lhs.offset_) - static_cast<difference_type>(rhs.offset_)) / elementSize;
+    }
+
+    // comparison
+    FLUENT_NODISCARD friend constexpr bool operator==(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ == rhs.offset_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ != rhs.offset_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ < rhs.offset_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ > rhs.offset_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator<=(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ <= rhs.offset_;
+    }
+    FLUENT_NODISCARD friend constexpr bool operator>=(offset_ptr lhs, offset_ptr rhs) noexcept
+    {
+        return lhs.offset_ >= rhs.offset_;
+    }
+
+private:
+    struct RawTag
+    {
+    };
+
+    constexpr offset_ptr(Offset offset, RawTag) noexcept : offset_(offset)
+    {
+    }
+
+    static constexpr Offset null = std::numeric_limits<Offset>::max();
+    static constexpr difference_type elementSize = static_cast<difference_type>(sizeof(T));
+
+    Offset offset_;
+};
+
+// Memory region, such as a memory-mapped file, in which offset_ptrs with the same Tag point.
+// Its size is at most the null value of Offset, so that the offset of any object inside it can be represented.
+template <typename Tag, typename Offset = std::uint32_t>
+class region
+{
+    static_assert(std::is_unsigned<Offset>::value, "region requires an unsigned offset type");
+
+public:
+    using offset_type = Offset;
+
+    constexpr region(void* base, std::size_t size) noexcept
+        : base_(static_cast<unsigned char*>(base)), size_(size)
+    {
+        FLUENT_ASSERT(size <= std::numeric_limits<Offset>::max());
+    }
+
+    FLUENT_NODISCARD constexpr void* base() const noexcept
+    {
+        return base_;
+    }
+    FLUENT_NODISCARD constexpr std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    // nullptr for the null offset_ptr
+    template <typename T, typename PointerOffset>
+    FLUENT_NODISCARD T* get(offset_ptr<T, Tag, PointerOffset> pointer) const noexcept
+    {
+        if (!pointer)
+        {
+            return nullptr;
+        }
+        FLUENT_ASSERT(pointer.raw() + sizeof(T) <= size_);
+        return static_cast<T*>(static_cast<void*>(base_ + pointer.raw()));
+    }
+    template <typename T, typename PointerOffset>
+    FLUENT_NODISCARD T& operator[](offset_ptr<T, Tag, PointerOffset> pointer) const noexcept
+    {
+        FLUENT_ASSERT(pointer);
+        return *get(pointer);
+    }
+
+    // offset_ptr to an object inside the region, or the null offset_ptr for nullptr.
+    // The offset must be below the null value of PointerOffset, that a smaller type than Offset may not reach.
+    template <typename PointerOffset = Offset, typename T>
+    FLUENT_NODISCARD offset_ptr<T, Tag, PointerOffset> offset_of(T* object) const noexcept
+    {
+        if (object == nullptr)
+        {
+            return nullptr;
+        }
+        unsigned char const* const address = static_cast<unsigned char const*>(static_cast<void const*>(object));
+        FLUENT_ASSERT(std::greater_equal<unsigned char const*>()(address, base_)
+                      && std::less_equal<unsigned char const*>()(address + sizeof(T), base_ + size_));
+        std::size_t const offset = static_cast<std::size_t>(address - base_);
+        FLUENT_ASSERT(offset < std::numeric_limits<PointerOffset>::max());
+        return offset_ptr<T, Tag, PointerOffset>::fromRaw(static_cast<PointerOffset>(offset));
+    }
+
+private:
+    unsigned char* base_;
+    std::size_t size_;
+};
+
+} // namespace fluent
+
+#endif
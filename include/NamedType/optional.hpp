@@ -0,0 +1,252 @@
+#ifndef OPTIONAL_HPP
+#define OPTIONAL_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace fluent
+{
+
+// Skills reserving one value of the underlying type to represent an empty fluent::optional
+
+template <typename T>
+struct EmptyIfZero : crtp<T, EmptyIfZero>
+{
+    template <typename U>
+    static constexpr U emptyValue() noexcept
+    {
+        return U{};
+    }
+    template <typename U>
+    static constexpr bool isEmptyValue(U const& value) noexcept
+    {
+        return value == U{};
+    }
+};
+
+template <typename T>
+struct EmptyIfMax : crtp<T, EmptyIfMax>
+{
+    template <typename U>
+    static constexpr U emptyValue() noexcept
+    {
+        return std::numeric_limits<U>::max();
+    }
+    template <typename U>
+    static constexpr bool isEmptyValue(U const& value) noexcept
+    {
+        return value == std::numeric_limits<U>::max();
+    }
+};
+
+template <typename T>
+struct EmptyIfNaN : crtp<T, EmptyIfNaN>
+{
+    template <typename U>
+    static constexpr U emptyValue() noexcept
+    {
+        static_assert(std::numeric_limits<U>::has_quiet_NaN, "EmptyIfNaN requires a floating point underlying type");
+        return std::numeric_limits<U>::quiet_NaN();
+    }
+    template <typename U>
+    static constexpr bool isEmptyValue(U const& value) noexcept
+    {
+        return std::isnan(value);
+    }
+};
+
+struct nullopt_t
+{
+    explicit constexpr nullopt_t(int)
+    {
+    }
+};
+
+constexpr nullopt_t nullopt{0};
+
+class bad_optional_access : public std::logic_error
+{
+public:
+    bad_optional_access() : std::logic_error("fluent::optional: access to an empty optional")
+    {
+    }
+};
+
+// Optional strong value that takes no more space than the strong type, by storing the value reserved by
+// its EmptyIfZero, EmptyIfMax or EmptyIfNaN skill when it is empty. Assigning this value empties the optional.
+template <typename Strong>
+class optional
+{
+public:
+    using value_type = Strong;
+
+    constexpr optional() noexcept : value_(emptyStrong(std::is_default_constructible<Strong>{}))
+    {
+    }
+
+    constexpr optional(nullopt_t) noexcept : optional()
+    {
+    }
+
+    constexpr optional(Strong const& value) noexcept(std::is_nothrow_copy_constructible<Strong>::value)
+        : value_(value)
+    {
+    }
+
+    FLUENT_CONSTEXPR17 optional& operator=(nullopt_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    FLUENT_CONSTEXPR17 optional& operator=(Strong const& value)
+    {
+        value_ = value;
+        return *this;
+    }
+
+    template <typename... Args>
+    FLUENT_CONSTEXPR17 Strong& emplace(Args&&... args)
+    {
+        value_ = Strong(std::forward<Args>(args)...);
+        return value_;
+    }
+
+    FLUENT_CONSTEXPR17 void reset() noexcept
+    {
+        value_.get() = emptyValue();
+    }
+
+    FLUENT_NODISCARD constexpr bool has_value() const noexcept
+    {
+        return !Strong::isEmptyValue(value_.get());
+    }
+
+    FLUENT_NODISCARD explicit constexpr operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    // unchecked access
+    FLUENT_NODISCARD constexpr Strong const& operator*() const noexcept
+    {
+        return value_;
+    }
+    FLUENT_NODISCARD constexpr Strong& operator*() noexcept
+    {
+        return value_;
+    }
+    FLUENT_NODISCARD constexpr Strong const* operator->() const noexcept
+    {
+        return &value_;
+    }
+    FLUENT_NODISCARD constexpr Strong* operator->() noexcept
+    {
+        return &value_;
+    }
+
+    // checked access
+    FLUENT_NODISCARD constexpr Strong const& value() const
+    {
+        return has_value() ? value_ : throw bad_optional_access();
+    }
+    FLUENT_NODISCARD FLUENT_CONSTEXPR17 Strong& value()
+    {
+        if (!has_value())
+        {
+            throw bad_optional_access();
+        }
+        return value_;
+    }
+
+    FLUENT_NODISCARD constexpr Strong value_or(Strong const& defaultValue) const
+    {
+        return has_value() ? value_ : defaultValue;
+    }
+
+    // Empty optionals are equal to each other, whatever the representation of their empty value
+    FLUENT_NODISCARD friend constexpr bool operator==(optional const& lhs, optional const& rhs) noexcept
+    {
+        return lhs.has_value() == rhs.has_value()
+               && (!lhs.has_value() || std::equal_to<Underlying>()(lhs.value_.get(), rhs.value_.get()));
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(optional const& lhs, optional const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    FLUENT_NODISCARD friend constexpr bool operator==(optional const& lhs, nullopt_t) noexcept
+    {
+        return !lhs.has_value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator==(nullopt_t, optional const& rhs) noexcept
+    {
+        return !rhs.has_value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(optional const& lhs, nullopt_t) noexcept
+    {
+        return lhs.has_value();
+    }
+    FLUENT_NODISCARD friend constexpr bool operator!=(nullopt_t, optional const& rhs) noexcept
+    {
+        return rhs.has_value();
+    }
+
+private:
+    using Underlying = std::remove_reference_t<typename Strong::UnderlyingType>;
+
+    static constexpr Underlying emptyValue() noexcept
+    {
+        return Strong::template emptyValue<Underlying>();
+    }
+
+    // Strong types without invariants accept the empty value
+    static constexpr Strong emptyStrong(std::true_type /* isDefaultConstructible */) noexcept
+    {
+        return Strong(emptyValue());
+    }
+    // The empty value of strong types with invariants, such as NonZero with EmptyIfZero, usually breaks them, and is
+    // stored without checking them
+    static Strong emptyStrong(std::false_type /* isDefaultConstructible */) noexcept
+    {
+        static_assert(sizeof(Strong) == sizeof(Underlying) && std::is_trivially_copyable<Strong>::value,
+                      "fluent::optional of a strong type with invariants requires a trivially copyable strong type "
+                      "of the size of its underlying type");
+        Underlying const empty = emptyValue();
+        return details::fromBytes<Strong>(&empty);
+    }
+
+    Strong value_;
+};
+
+template <typename Strong>
+constexpr optional<Strong> make_optional(Strong const& value)
+{
+    return optional<Strong>(value);
+}
+
+} // namespace fluent
+
+namespace std
+{
+template <typename Strong>
+struct hash<fluent::optional<Strong>>
+{
+    size_t operator()(fluent::optional<Strong> const& x) const noexcept
+    {
+        using Underlying = std::remove_reference_t<typename Strong::UnderlyingType>;
+        return x.has_value() ? std::hash<Underlying>()(x->get()) : 0;
+    }
+};
+
+} // namespace std
+
+#endif
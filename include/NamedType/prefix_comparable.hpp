@@ -0,0 +1,117 @@
+#ifndef PREFIX_COMPARABLE_HPP
+#define PREFIX_COMPARABLE_HPP
+
+#include "byte_order.hpp"
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace fluent
+{
+
+namespace details
+{
+
+// The first 8 characters of the string, as a big endian integer padded with zeros: if the prefix of a string is less
+// than the one of another string, so is the string. Equal prefixes don't tell anything.
+template <typename Traits, typename Allocator>
+std::uint64_t stringPrefix(std::basic_string<char, Traits, Allocator> const& value) noexcept
+{
+    unsigned char bytes[sizeof(std::uint64_t)] = {};
+    std::memcpy(bytes, value.data(), value.size() < sizeof(bytes) ? value.size() : sizeof(bytes));
+    return BigEndianOrder::load<std::uint64_t>(bytes);
+}
+
+} // namespace details
+
+// Strong types over strings whose comparisons can be abbreviated to the ones of their prefixes, by prefix_keyed
+template <typename T>
+struct PrefixComparable : crtp<T, PrefixComparable>
+{
+    FLUENT_NODISCARD std::uint64_t prefix() const noexcept
+    {
+        return details::stringPrefix(this->underlying().get());
+    }
+};
+
+namespace details
+{
+
+template <typename T>
+struct IsPrefixComparable : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct IsPrefixComparable<NamedType<T, Parameter, Skills...>>
+    : std::is_base_of<PrefixComparable<NamedType<T, Parameter, Skills...>>, NamedType<T, Parameter, Skills...>>
+{
+};
+
+} // namespace details
+
+// Value of a PrefixComparable strong type stored next to the prefix of its string. Comparing prefix_keyed values
+// compares their prefixes, and only reads the strings, that are usually on the heap, when the prefixes are equal.
+// This makes sorting and binary searching containers of them faster when the strings mostly differ in their first 8
+// characters. The value can't be modified, so that its prefix stays up to date.
+template <typename Strong>
+class prefix_keyed
+{
+    static_assert(details::IsPrefixComparable<Strong>::value,
+                  "prefix_keyed requires a strong type with the PrefixComparable skill");
+
+public:
+    using strong_type = Strong;
+
+    explicit prefix_keyed(Strong value) noexcept(std::is_nothrow_move_constructible<Strong>::value)
+        : prefix_(value.prefix()), value_(std::move(value))
+    {
+    }
+
+    FLUENT_NODISCARD Strong const& get() const noexcept
+    {
+        return value_;
+    }
+    FLUENT_NODISCARD std::uint64_t prefix() const noexcept
+    {
+        return prefix_;
+    }
+
+    FLUENT_NODISCARD friend bool operator<(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return lhs.prefix_ != rhs.prefix_ ? lhs.prefix_ < rhs.prefix_ : lhs.value_.get() < rhs.value_.get();
+    }
+    FLUENT_NODISCARD friend bool operator>(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+    FLUENT_NODISCARD friend bool operator<=(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+    FLUENT_NODISCARD friend bool operator>=(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+    FLUENT_NODISCARD friend bool operator==(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return lhs.prefix_ == rhs.prefix_ && lhs.value_.get() == rhs.value_.get();
+    }
+    FLUENT_NODISCARD friend bool operator!=(prefix_keyed const& lhs, prefix_keyed const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::uint64_t prefix_;
+    Strong value_;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include "named_type_impl.hpp"
+#include "prefix_comparable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+namespace details
+{
+
+// Unsigned bits of a value, ordered as the values: the key of a is less than the key of b if a < b.
+// Keys of inexact types only order a prefix of the values, and equal keys are then ordered by the values themselves.
+template <typename T, typename = void>
+struct RadixKey;
+
+template <typename T>
+struct RadixKey<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+{
+    using type = std::make_unsigned_t<T>;
+    static constexpr bool isExact = true;
+
+    static constexpr type get(T value) noexcept
+    {
+        // Flipping the sign bit moves negative values before positive ones
+        return static_cast<type>(static_cast<type>(value) ^ signBit());
+    }
+
+private:
+    static constexpr type signBit() noexcept
+    {
+        return std::is_signed<T>::value ? static_cast<type>(type{1} << (sizeof(type) * 8 - 1)) : type{0};
+    }
+};
+
+template <typename T>
+struct RadixKey<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+    using Underlying = std::underlying_type_t<T>;
+    using type = typename RadixKey<Underlying>::type;
+    static constexpr bool isExact = true;
+
+    static constexpr type get(T value) noexcept
+    {
+        return RadixKey<Underlying>::get(static_cast<Underlying>(value));
+    }
+};
+
+// Negative values come before -0.0, that comes before +0.0. NaNs with their sign bit set come first, and other NaNs
+// come last.
+template <typename T>
+struct RadixKey<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "radix_sort supports floating point types of 32 and 64 bits");
+    using type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    static constexpr bool isExact = true;
+
+    static type get(T value) noexcept
+    {
+        type bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        type const signBit = static_cast<type>(type{1} << (sizeof(type) * 8 - 1));
+        // Negative values are larger for smaller values: flipping all their bits reverses their order and puts them
+        // before positive values, that only get their sign bit set
+        return (bits & signBit) != 0 ? static_cast<type>(~bits) : static_cast<type>(bits | signBit);
+    }
+};
+
+// The first 8 characters
+template <typename Traits, typename Allocator>
+struct RadixKey<std::basic_string<char, Traits, Allocator>>
+{
+    using type = std::uint64_t;
+    static constexpr bool isExact = false;
+
+    static type get(std::basic_string<char, Traits, Allocator> const& value) noexcept
+    {
+        return stringPrefix(value);
+    }
+};
+
+template <typename T>
+constexpr T const& radixValue(T const& value) noexcept
+{
+    return value;
+}
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+constexpr std::remove_reference_t<T> const& radixValue(NamedType<T, Parameter, Skills...> const& value) noexcept
+{
+    return value.get();
+}
+
+struct RadixIdentity
+{
+    template <typename T>
+    constexpr T const& operator()(T const& value) const noexcept
+    {
+        return value;
+    }
+};
+
+// Below this size, comparison sorts beat the fixed cost of the histograms
+constexpr std::size_t radixSortThreshold = 256;
+
+// Sorts payloads by their keys, one byte at a time from the least significant one
+template <typename Payload, typename KeyOf>
+void radixSortPayloads(std::vector<Payload>& payloads, KeyOf keyOf)
+{
+    using Bits = decltype(keyOf(payloads[0]));
+    constexpr std::size_t passes = sizeof(Bits);
+    constexpr std::size_t digits = 256;
+    std::size_t const size = payloads.size();
+    std::array<std::size_t, passes * digits> counts = {};
+    for (Payload const& payload : payloads)
+    {
+        Bits const key = keyOf(payload);
+        for (std::size_t pass = 0; pass < passes; ++pass)
+        {
+            ++counts[pass * digits + static_cast<std::size_t>((key >> (8 * pass)) & 0xFFu)];
+        }
+    }
+
+    std::vector<Payload> sortedPayloads(payloads);
+    for (std::size_t pass = 0; pass < passes; ++pass)
+    {
+        auto const digitOf = [pass, &keyOf](Payload const& payload) {
+            return static_cast<std::size_t>((keyOf(payload) >> (8 * pass)) & 0xFFu);
+        };
+        std::size_t* const count = counts.data() + pass * digits;
+        if (count[digitOf(payloads[0])] == size)
+        {
+            continue; // all keys have the same byte
+        }
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < digits; ++digit)
+        {
+            std::size_t const digitCount = count[digit];
+            count[digit] = offset;
+            offset += digitCount;
+        }
+        for (Payload const& payload : payloads)
+        {
+            sortedPayloads[count[digitOf(payload)]++] = payload;
+        }
+        payloads.swap(sortedPayloads);
+    }
+}
+
+// Trivially copyable elements are sorted directly, recomputing their keys at each pass, which moves less memory than
+// sorting keys along with positions and avoids gathering the elements in random order at the end
+template <typename RandomIterator, typename KeyOf>
+void radixSortElements(RandomIterator first, RandomIterator last, KeyOf keyOf, std::true_type)
+{
+    using Element = typename std::iterator_traits<RandomIterator>::value_type;
+    std::vector<Element> elements(first, last);
+    radixSortPayloads(elements, keyOf);
+    std::copy(elements.begin(), elements.end(), first);
+}
+
+template <typename Bits>
+struct KeyedPosition
+{
+    Bits key;
+    std::size_t position;
+};
+
+template <typename RandomIterator, typename KeyOf>
+void radixSortElements(RandomIterator first, RandomIterator last, KeyOf keyOf, std::false_type)
+{
+    using Element = typename std::iterator_traits<RandomIterator>::value_type;
+    using Bits = decltype(keyOf(*first));
+    std::vector<KeyedPosition<Bits>> positions;
+    positions.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (RandomIterator element = first; element != last; ++element)
+    {
+        positions.push_back({keyOf(*element), positions.size()});
+    }
+    radixSortPayloads(positions, [](KeyedPosition<Bits> const& keyed) { return keyed.key; });
+    std::vector<Element> sorted;
+    sorted.reserve(positions.size());
+    for (KeyedPosition<Bits> const& keyed : positions)
+    {
+        sorted.push_back(std::move(first[static_cast<std::ptrdiff_t>(keyed.position)]));
+    }
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
+} // namespace details
+
+// Stable sort of the range by the strong type or arithmetic value returned by projection, that orders the values by
+// the bits of their underlying values instead of comparing them: integers, enums, floating point values and strings
+// (by their first 8 characters, then by comparison) are sorted with one pass per byte of their keys, skipping the bytes
+// that all keys share. Ranges of fewer than 256 elements are sorted by comparing their keys.
+// Floating point values are ordered as by std::less, with -0.0 before +0.0 and NaNs at the ends.
+template <typename RandomIterator, typename Projection>
+void radix_sort(RandomIterator first, RandomIterator last, Projection projection)
+{
+    using Element = typename std::iterator_traits<RandomIterator>::value_type;
+    using Value = std::decay_t<decltype(details::radixValue(projection(*first)))>;
+    using Key = details::RadixKey<Value>;
+    using Bits = typename Key::type;
+
+    auto const keyOf = [&projection](Element const& element) {
+        return Key::get(details::radixValue(projection(element)));
+    };
+    auto const valueLess = [&projection](Element const& lhs, Element const& rhs) {
+        return details::radixValue(projection(lhs)) < details::radixValue(projection(rhs));
+    };
+    if (static_cast<std::size_t>(std::distance(first, last)) < details::radixSortThreshold)
+    {
+        std::stable_sort(first, last, [&keyOf, &valueLess](Element const& lhs, Element const& rhs) {
+            Bits const lhsKey = keyOf(lhs);
+            Bits const rhsKey = keyOf(rhs);
+            return lhsKey < rhsKey || (!Key::isExact && lhsKey == rhsKey && valueLess(lhs, rhs));
+        });
+        return;
+    }
+
+    details::radixSortElements(first, last, keyOf, std::is_trivially_copyable<Element>{});
+    if (!Key::isExact)
+    {
+        // Orders the elements with equal keys by comparison
+        for (RandomIterator begin = first, end = first; begin != last; begin = end)
+        {
+            Bits const key = keyOf(*begin);
+            end = std::find_if(begin + 1, last, [&keyOf, key](Element const& element) {
+                return keyOf(element) != key;
+            });
+            if (end - begin > 1)
+            {
+                std::stable_sort(begin, end, valueLess);
+            }
+        }
+    }
+}
+
+template <typename RandomIterator>
+void radix_sort(RandomIterator first, RandomIterator last)
+{
+    radix_sort(first, last, details::RadixIdentity{});
+}
+
+// Sorts records by one of their fields
+template <typename Field, typename RandomIterator>
+void radix_sort_by(RandomIterator first, RandomIterator last)
+{
+    using Record = typename std::iterator_traits<RandomIterator>::value_type;
+    radix_sort(first, last, [](Record const& value) -> Field const& { return value.template get<Field>(); });
+}
+
+} // namespace fluent
+
+#endif
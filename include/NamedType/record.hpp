@@ -0,0 +1,257 @@
+#ifndef RECORD_HPP
+#define RECORD_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fluent
+{
+
+namespace details
+{
+
+// Index in Fields of the field placed at position Rank, once the fields are sorted by decreasing alignment.
+// The sort is stable, so that fields with the same alignment stay in their declaration order.
+template <typename... Fields>
+constexpr std::size_t indexOfAlignmentRank(std::size_t rank)
+{
+    std::size_t const alignments[] = {alignof(Fields)...};
+    for (std::size_t index = 0; index < sizeof...(Fields); ++index)
+    {
+        std::size_t indexRank = 0;
+        for (std::size_t other = 0; other < sizeof...(Fields); ++other)
+        {
+            if (alignments[other] > alignments[index] || (alignments[other] == alignments[index] && other < index))
+            {
+                ++indexRank;
+            }
+        }
+        if (indexRank == rank)
+        {
+            return index;
+        }
+    }
+    return sizeof...(Fields);
+}
+
+struct FromTuple
+{
+};
+
+// Nested storage of fields sorted by decreasing alignment: since the alignment of each nested level is at most the one
+// of the field preceding it, this lays out the fields without padding between them.
+template <typename... Fields>
+struct RecordStorage;
+
+template <typename Last>
+struct RecordStorage<Last>
+{
+    constexpr RecordStorage() : head()
+    {
+    }
+    template <typename Tuple>
+    constexpr RecordStorage(FromTuple, Tuple& values) : head(std::move(std::get<Last>(values)))
+    {
+    }
+
+    Last head;
+};
+
+template <typename Head, typename Next, typename... Tail>
+struct RecordStorage<Head, Next, Tail...>
+{
+    constexpr RecordStorage() : head(), tail()
+    {
+    }
+    template <typename Tuple>
+    constexpr RecordStorage(FromTuple, Tuple& values)
+        : head(std::move(std::get<Head>(values))), tail(FromTuple{}, values)
+    {
+    }
+
+    Head head;
+    RecordStorage<Next, Tail...> tail;
+};
+
+template <typename Field, typename Storage>
+struct FieldAccess;
+
+template <typename Field, typename... Tail>
+struct FieldAccess<Field, RecordStorage<Field, Tail...>>
+{
+    static constexpr Field& get(RecordStorage<Field, Tail...>& storage) noexcept
+    {
+        return storage.head;
+    }
+    static constexpr Field const& get(RecordStorage<Field, Tail...> const& storage) noexcept
+    {
+        return storage.head;
+    }
+};
+
+template <typename Field, typename Head, typename... Tail>
+struct FieldAccess<Field, RecordStorage<Head, Tail...>>
+{
+    static constexpr Field& get(RecordStorage<Head, Tail...>& storage) noexcept
+    {
+        return FieldAccess<Field, RecordStorage<Tail...>>::get(storage.tail);
+    }
+    static constexpr Field const& get(RecordStorage<Head, Tail...> const& storage) noexcept
+    {
+        return FieldAccess<Field, RecordStorage<Tail...>>::get(storage.tail);
+    }
+};
+
+// Sum of the sizes of the first count fields
+template <typename... Fields>
+constexpr std::size_t sizeOfFirstFields(std::size_t count) noexcept
+{
+    std::size_t const sizes[] = {sizeof(Fields)...};
+    std::size_t size = 0;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        size += sizes[index];
+    }
+    return size;
+}
+
+template <typename... Fields>
+constexpr std::size_t sizeOfFields() noexcept
+{
+    return sizeOfFirstFields<Fields...>(sizeof...(Fields));
+}
+
+template <typename Fields, typename Ranks>
+struct SortedRecordStorage;
+
+template <typename... Fields, std::size_t... Ranks>
+struct SortedRecordStorage<std::tuple<Fields...>, std::index_sequence<Ranks...>>
+{
+    using type =
+        RecordStorage<std::tuple_element_t<indexOfAlignmentRank<Fields...>(Ranks), std::tuple<Fields...>>...>;
+};
+
+} // namespace details
+
+// Aggregate of values of distinct strong types, accessed by their types:
+//
+//     fluent::record<Side, Price, Quantity> order(Quantity{100}, Price{10.5}, Side{'B'}); // fields in any order
+//     order.get<Price>() = Price{11};
+//
+// The fields are laid out by decreasing alignment to minimize padding, whatever their declaration order.
+// A record is trivially copyable if its fields are, and can then be serialized with memcpy, without its padding.
+template <typename... Fields>
+class record
+{
+    static_assert(sizeof...(Fields) > 0, "a record has at least one field");
+    static_assert(details::AreDistinct<Fields...>::value, "the fields of a record must have distinct types");
+
+    using Storage = typename details::SortedRecordStorage<std::tuple<Fields...>,
+                                                          std::make_index_sequence<sizeof...(Fields)>>::type;
+
+    template <typename... Values>
+    using IfAreFields = std::enable_if_t<sizeof...(Values) == sizeof...(Fields)
+                                         && details::AreDistinct<std::decay_t<Values>...>::value
+                                         && details::AllOf<(details::CountOf<std::decay_t<Values>, Fields...>::value
+                                                            == 1)...>::value>;
+
+public:
+    // Size of the bytes written by serialize and read by deserialize: the sizes of the fields, without padding
+    static constexpr std::size_t serialized_size = details::sizeOfFields<Fields...>();
+
+    constexpr record() : storage_()
+    {
+    }
+
+    // The fields can be passed in any order, as they are identified by their types
+    template <typename... Values, typename = IfAreFields<Values...>>
+    constexpr record(Values&&... values)
+        : record(details::FromTuple{}, std::make_tuple(std::forward<Values>(values)...))
+    {
+    }
+
+    template <typename Field>
+    FLUENT_NODISCARD constexpr Field& get() noexcept
+    {
+        static_assert(details::CountOf<Field, Fields...>::value == 1, "this field is not in the record");
+        return details::FieldAccess<Field, Storage>::get(storage_);
+    }
+    template <typename Field>
+    FLUENT_NODISCARD constexpr Field const& get() const noexcept
+    {
+        static_assert(details::CountOf<Field, Fields...>::value == 1, "this field is not in the record");
+        return details::FieldAccess<Field, Storage>::get(storage_);
+    }
+
+    // Copies the serialized_size bytes of the record to destination: in one go if the record has no padding, and
+    // otherwise field by field in declaration order, so that the bytes of the padding are not written
+    void serialize(void* destination) const noexcept
+    {
+        static_assert(std::is_trivially_copyable<Storage>::value,
+                      "only records of trivially copyable fields can be serialized");
+        if (serialized_size == sizeof(Storage))
+        {
+            std::memcpy(destination, &storage_, sizeof(Storage));
+            return;
+        }
+        unsigned char* bytes = static_cast<unsigned char*>(destination);
+        using expand = int[];
+        static_cast<void>(expand{
+            0, (std::memcpy(bytes, &get<Fields>(), sizeof(Fields)), bytes += sizeof(Fields), 0)...});
+    }
+
+    // Reads a record from serialized_size bytes written by serialize. The fields don't need to be default
+    // constructible, and their invariants are not checked, as they were when the record was serialized.
+    FLUENT_NODISCARD static record deserialize(void const* source) noexcept
+    {
+        static_assert(std::is_trivially_copyable<Storage>::value,
+                      "only records of trivially copyable fields can be serialized");
+        if (serialized_size == sizeof(Storage))
+        {
+            return details::fromBytes<record>(source);
+        }
+        return deserializeFields(static_cast<unsigned char const*>(source), std::index_sequence_for<Fields...>{});
+    }
+
+    FLUENT_NODISCARD friend bool operator==(record const& lhs, record const& rhs)
+    {
+        bool const equalFields[] = {(lhs.template get<Fields>() == rhs.template get<Fields>())...};
+        for (bool const equalField : equalFields)
+        {
+            if (!equalField)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    FLUENT_NODISCARD friend bool operator!=(record const& lhs, record const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    template <typename Tuple>
+    constexpr record(details::FromTuple, Tuple&& values) : storage_(details::FromTuple{}, values)
+    {
+    }
+
+    template <std::size_t... Indexes>
+    static record deserializeFields(unsigned char const* bytes, std::index_sequence<Indexes...>) noexcept
+    {
+        return record(details::FromTuple{},
+                      std::make_tuple(details::fromBytes<Fields>(
+                          bytes + details::sizeOfFirstFields<Fields...>(Indexes))...));
+    }
+
+    Storage storage_;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef SEQLOCKED_HPP
+#define SEQLOCKED_HPP
+
+#include "named_type_impl.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Value of a trivially copyable type, such as a strong type or a fluent::record, shared between a single writer thread
+// and many reader threads. Readers never block the writer nor each other: a read copies the value and starts over if
+// the writer modified it in the meantime. This makes it suited to values too large for std::atomic, that are read much
+// more often than they are written.
+// The value is stored in relaxed atomic words, so that reading it during a write is not a data race.
+template <typename T>
+class seqlocked
+{
+    static_assert(std::is_trivially_copyable<T>::value, "seqlocked requires a trivially copyable type");
+
+public:
+    using value_type = T;
+
+    seqlocked() noexcept : sequence_(0), words_()
+    {
+        storeWords(T());
+    }
+    explicit seqlocked(T const& value) noexcept : sequence_(0), words_()
+    {
+        storeWords(value);
+    }
+    seqlocked(seqlocked const&) = delete;
+    seqlocked& operator=(seqlocked const&) = delete;
+
+    // Only one thread may store at a time
+    void store(T const& value) noexcept
+    {
+        Sequence const sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed); // odd while writing
+        std::atomic_thread_fence(std::memory_order_release);
+        storeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Doesn't require T to be default constructible
+    FLUENT_NODISCARD T load() const noexcept
+    {
+        Word words[wordCount];
+        while (!tryLoadWords(words))
+        {
+        }
+        return details::fromBytes<T>(words);
+    }
+
+    // Reads the value without retrying: returns false, leaving value unchanged, if the writer was storing concurrently
+    bool try_load(T& value) const noexcept
+    {
+        Word words[wordCount];
+        if (!tryLoadWords(words))
+        {
+            return false;
+        }
+        std::memcpy(&value, words, sizeof(T));
+        return true;
+    }
+
+private:
+    using Sequence = std::size_t;
+    using Word = std::size_t;
+    static constexpr std::size_t wordCount = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    bool tryLoadWords(Word (&words)[wordCount]) const noexcept
+    {
+        Sequence const before = sequence_.load(std::memory_order_acquire);
+        if (before % 2 != 0)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < wordCount; ++i)
+        {
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence_.load(std::memory_order_relaxed) == before;
+    }
+
+    void storeWords(T const& value) noexcept
+    {
+        Word words[wordCount] = {};
+        std::memcpy(words, &value, sizeof(T));
+        for (std::size_t i = 0; i < wordCount; ++i)
+        {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<Sequence> sequence_;
+    std::atomic<Word> words_[wordCount];
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef SERIAL_NUMBER_HPP
+#define SERIAL_NUMBER_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace fluent
+{
+
+// Serial number arithmetic (RFC 1982): unsigned values that wrap around, and are compared within half of their range.
+
+namespace details
+{
+
+template <typename U>
+struct SerialTraits
+{
+    static_assert(std::is_unsigned<U>::value, "serial numbers require an unsigned underlying type");
+    static constexpr U half = static_cast<U>(U{1} << (std::numeric_limits<U>::digits - 1));
+};
+
+template <typename U>
+constexpr U serialNext(U value)
+{
+    return static_cast<U>(value + 1u);
+}
+
+template <typename U>
+constexpr U serialPrevious(U value)
+{
+    return static_cast<U>(value - 1u);
+}
+
+template <typename U>
+constexpr U serialDifference(U from, U to)
+{
+    return static_cast<U>(to - from);
+}
+
+// from < to if to is ahead of from by less than half of the range. Values exactly half a range apart are unordered.
+template <typename U>
+constexpr bool serialLess(U from, U to)
+{
+    return static_cast<U>(serialDifference(from, to) - 1u) < static_cast<U>(SerialTraits<U>::half - 1u);
+}
+
+} // namespace details
+
+template <typename T>
+struct SerialComparable : crtp<T, SerialComparable>
+{
+    FLUENT_NODISCARD constexpr bool operator<(SerialComparable<T> const& other) const
+    {
+        return details::serialLess(this->underlying().get(), other.underlying().get());
+    }
+    FLUENT_NODISCARD constexpr bool operator>(SerialComparable<T> const& other) const
+    {
+        return details::serialLess(other.underlying().get(), this->underlying().get());
+    }
+    FLUENT_NODISCARD constexpr bool operator<=(SerialComparable<T> const& other) const
+    {
+        return *this == other || *this < other;
+    }
+    FLUENT_NODISCARD constexpr bool operator>=(SerialComparable<T> const& other) const
+    {
+        return *this == other || *this > other;
+    }
+    FLUENT_NODISCARD constexpr bool operator==(SerialComparable<T> const& other) const
+    {
+        return this->underlying().get() == other.underlying().get();
+    }
+    FLUENT_NODISCARD constexpr bool operator!=(SerialComparable<T> const& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename T>
+struct WrappingIncrementable : crtp<T, WrappingIncrementable>
+{
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
+
+    FLUENT_CONSTEXPR17 T& operator++()
+    {
+        auto& value = this->underlying().get();
+        value = details::serialNext(value);
+        return this->underlying();
+    }
+    FLUENT_CONSTEXPR17 T operator++(int)
+    {
+        T const old = this->underlying();
+        ++*this;
+        return old;
+    }
+    FLUENT_CONSTEXPR17 T& operator--()
+    {
+        auto& value = this->underlying().get();
+        value = details::serialPrevious(value);
+        return this->underlying();
+    }
+    FLUENT_CONSTEXPR17 T operator--(int)
+    {
+        T const old = this->underlying();
+        --*this;
+        return old;
+    }
+
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
+};
+
+template <typename T>
+struct FLUENT_EBCO SerialNumber
+    : SerialComparable<T>
+    , WrappingIncrementable<T>
+{
+};
+
+// Signed number of steps from 'from' to 'to', taking the shortest way around.
+template <typename T, typename Parameter, template <typename> class... Skills>
+constexpr std::make_signed_t<T> serial_distance(
+    NamedType<T, Parameter, Skills...> const& from,
+    NamedType<T, Parameter, Skills...> const& to)
+{
+    using Signed = std::make_signed_t<T>;
+    auto const difference = details::serialDifference(from.get(), to.get());
+    return difference < details::SerialTraits<T>::half
+               ? static_cast<Signed>(difference)
+               : static_cast<Signed>(-static_cast<Signed>(static_cast<T>(-difference) - 1u) - 1);
+}
+
+// Returns the first element of a sequence of serial numbers that is not followed by its successor, like
+// std::adjacent_find, or last if the sequence has no gap. The mismatches of a whole block are OR-ed together without
+// early exit so that the compiler can vectorize them, and only the block containing the gap is scanned element-wise.
+template <typename T, typename Parameter, template <typename> class... Skills>
+NamedType<T, Parameter, Skills...> const* find_first_gap(
+    NamedType<T, Parameter, Skills...> const* first,
+    NamedType<T, Parameter, Skills...> const* last)
+{
+    constexpr std::ptrdiff_t blockSize = 64;
+    auto const breaksSequence = [](NamedType<T, Parameter, Skills...> const* position) {
+        return position[1].get() != details::serialNext(position[0].get());
+    };
+
+    if (last - first < 2)
+    {
+        return last;
+    }
+    auto const end = last - 1;
+    auto position = first;
+    for (; end - position >= blockSize; position += blockSize)
+    {
+        T gaps = 0;
+        for (std::ptrdiff_t i = 0; i < blockSize; ++i)
+        {
+            gaps |= static_cast<T>(position[i + 1].get() ^ details::serialNext(position[i].get()));
+        }
+        if (gaps != 0)
+        {
+            break;
+        }
+    }
+    for (; position != end; ++position)
+    {
+        if (breaksSequence(position))
+        {
+            return position;
+        }
+    }
+    return last;
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,369 @@
+#ifndef SERIALIZATION_HPP
+#define SERIALIZATION_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+#include "record.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Binary serialization of strong types, records and sequences of them, in the byte order of the target.
+// Values whose bytes are their whole content, such as strong types over arithmetic types, are copied with memcpy, and
+// contiguous sequences of them are copied with a single memcpy. Other values are encoded field by field.
+
+namespace fluent
+{
+
+// Lets fluent::serialize and fluent::deserialize handle the strong type, by serializing its underlying value
+template <typename T>
+struct Serializable : crtp<T, Serializable>
+{
+};
+
+// Appends serialized bytes to a vector
+class byte_writer
+{
+public:
+    explicit byte_writer(std::vector<unsigned char>& bytes) noexcept : bytes_(bytes)
+    {
+    }
+
+    void write(void const* data, std::size_t size)
+    {
+        unsigned char const* const first = static_cast<unsigned char const*>(data);
+        bytes_.insert(bytes_.end(), first, first + size);
+    }
+
+private:
+    std::vector<unsigned char>& bytes_;
+};
+
+// Reads serialized bytes from a buffer, throwing std::out_of_range when reading past its end
+class byte_reader
+{
+public:
+    byte_reader(void const* data, std::size_t size) noexcept
+        : position_(static_cast<unsigned char const*>(data)), end_(position_ + size)
+    {
+    }
+    explicit byte_reader(std::vector<unsigned char> const& bytes) noexcept : byte_reader(bytes.data(), bytes.size())
+    {
+    }
+
+    void read(void* data, std::size_t size)
+    {
+        if (size > remaining())
+        {
+            throw std::out_of_range("fluent::byte_reader: not enough bytes");
+        }
+        if (size > 0)
+        {
+            std::memcpy(data, position_, size);
+        }
+        position_ += size;
+    }
+
+    // Reads bytes in place: data() points to the next remaining() bytes, and skip consumes them
+    FLUENT_NODISCARD unsigned char const* data() const noexcept
+    {
+        return position_;
+    }
+    void skip(std::size_t size)
+    {
+        if (size > remaining())
+        {
+            throw std::out_of_range("fluent::byte_reader: not enough bytes");
+        }
+        position_ += size;
+    }
+
+    FLUENT_NODISCARD std::size_t remaining() const noexcept
+    {
+        return static_cast<std::size_t>(end_ - position_);
+    }
+
+private:
+    unsigned char const* position_;
+    unsigned char const* end_;
+};
+
+// Defined in varint.hpp, and takes precedence over Serializable
+template <typename T>
+struct VarintEncodable;
+
+template <typename T, typename = void>
+struct serializer;
+
+namespace details
+{
+
+template <typename T>
+struct IsSerializableStrongType : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct IsSerializableStrongType<NamedType<T, Parameter, Skills...>>
+    : std::is_base_of<Serializable<NamedType<T, Parameter, Skills...>>, NamedType<T, Parameter, Skills...>>
+{
+};
+
+template <typename T>
+struct IsVarintEncodable : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct IsVarintEncodable<NamedType<T, Parameter, Skills...>>
+    : std::is_base_of<VarintEncodable<NamedType<T, Parameter, Skills...>>, NamedType<T, Parameter, Skills...>>
+{
+};
+
+// Serializable strong types that are not encoded as varints
+template <typename T>
+struct IsSerializedByUnderlying
+    : std::integral_constant<bool, IsSerializableStrongType<T>::value && !IsVarintEncodable<T>::value>
+{
+};
+
+template <typename T>
+struct HasInvariants : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct HasInvariants<NamedType<T, Parameter, Skills...>>
+    : std::integral_constant<
+          bool,
+          Invariants<std::remove_reference_t<T>, Skills<NamedType<T, Parameter, Skills...>>...>::isChecked>
+{
+};
+
+// Whether the bytes of T are its whole serialized form
+template <typename T, typename = void>
+struct IsTriviallySerializable : std::integral_constant<bool, std::is_arithmetic<T>::value || std::is_enum<T>::value>
+{
+};
+
+// Strong types without padding (as with CacheAligned) or invariants to check when deserializing
+template <typename T>
+struct IsTriviallySerializable<T, std::enable_if_t<IsSerializedByUnderlying<T>::value>>
+    : std::integral_constant<bool,
+                             IsTriviallySerializable<std::remove_reference_t<typename T::UnderlyingType>>::value
+                                 && sizeof(T) == sizeof(typename T::UnderlyingType) && !HasInvariants<T>::value>
+{
+};
+
+// Records without padding, whose bytes would otherwise be written
+template <typename... Fields>
+struct IsTriviallySerializable<record<Fields...>>
+    : std::integral_constant<bool,
+                             AllOf<IsTriviallySerializable<Fields>::value...>::value
+                                 && sizeof(record<Fields...>) == sizeOfFields<Fields...>()>
+{
+};
+
+template <typename T>
+void serializeSequence(byte_writer& writer, T const* values, std::size_t count, std::true_type)
+{
+    writer.write(values, count * sizeof(T));
+}
+
+template <typename T>
+void serializeSequence(byte_writer& writer, T const* values, std::size_t count, std::false_type)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        serializer<T>::write(writer, values[i]);
+    }
+}
+
+template <typename T>
+void deserializeSequence(byte_reader& reader, T* values, std::size_t count, std::true_type)
+{
+    reader.read(values, count * sizeof(T));
+}
+
+template <typename T>
+void deserializeSequence(byte_reader& reader, T* values, std::size_t count, std::false_type)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values[i] = serializer<T>::read(reader);
+    }
+}
+
+} // namespace details
+
+// Reads and writes a type. Specialize it to serialize other types.
+template <typename T>
+struct serializer<T, std::enable_if_t<details::IsTriviallySerializable<T>::value>>
+{
+    static void write(byte_writer& writer, T const& value)
+    {
+        writer.write(&value, sizeof(T));
+    }
+    static T read(byte_reader& reader)
+    {
+        T value{};
+        reader.read(&value, sizeof(T));
+        return value;
+    }
+};
+
+template <typename T>
+struct serializer<T,
+                  std::enable_if_t<details::IsSerializedByUnderlying<T>::value
+                                   && !details::IsTriviallySerializable<T>::value>>
+{
+    using Underlying = std::remove_reference_t<typename T::UnderlyingType>;
+
+    static void write(byte_writer& writer, T const& value)
+    {
+        serializer<Underlying>::write(writer, value.get());
+    }
+    static T read(byte_reader& reader)
+    {
+        return T(serializer<Underlying>::read(reader));
+    }
+};
+
+template <typename... Fields>
+struct serializer<record<Fields...>, std::enable_if_t<!details::IsTriviallySerializable<record<Fields...>>::value>>
+{
+    // Fields in declaration order
+    static void write(byte_writer& writer, record<Fields...> const& value)
+    {
+        using expand = int[];
+        static_cast<void>(expand{0, (serializer<Fields>::write(writer, value.template get<Fields>()), 0)...});
+    }
+    static record<Fields...> read(byte_reader& reader)
+    {
+        // Braced initialization reads the fields in order
+        return record<Fields...>{serializer<Fields>::read(reader)...};
+    }
+};
+
+template <typename Char>
+struct serializer<std::basic_string<Char>>
+{
+    static void write(byte_writer& writer, std::basic_string<Char> const& value)
+    {
+        serializer<std::uint64_t>::write(writer, value.size());
+        writer.write(value.data(), value.size() * sizeof(Char));
+    }
+    static std::basic_string<Char> read(byte_reader& reader)
+    {
+        std::basic_string<Char> value(checkedSize(reader), Char{});
+        reader.read(&value[0], value.size() * sizeof(Char));
+        return value;
+    }
+
+private:
+    static std::size_t checkedSize(byte_reader& reader)
+    {
+        std::uint64_t const size = serializer<std::uint64_t>::read(reader);
+        if (size > reader.remaining() / sizeof(Char))
+        {
+            throw std::out_of_range("fluent::deserialize: not enough bytes");
+        }
+        return static_cast<std::size_t>(size);
+    }
+};
+
+template <typename T>
+struct serializer<std::vector<T>>
+{
+    static void write(byte_writer& writer, std::vector<T> const& values)
+    {
+        serializer<std::uint64_t>::write(writer, values.size());
+        details::serializeSequence(writer, values.data(), values.size(), details::IsTriviallySerializable<T>{});
+    }
+    static std::vector<T> read(byte_reader& reader)
+    {
+        std::uint64_t const size = serializer<std::uint64_t>::read(reader);
+        // Each value takes at least one byte, so a larger size can only come from corrupted bytes
+        if (size > reader.remaining())
+        {
+            throw std::out_of_range("fluent::deserialize: not enough bytes");
+        }
+        std::vector<T> values;
+        readValues(reader, values, static_cast<std::size_t>(size), details::IsTriviallySerializable<T>{});
+        return values;
+    }
+
+private:
+    static void readValues(byte_reader& reader, std::vector<T>& values, std::size_t size, std::true_type)
+    {
+        values.resize(size);
+        details::deserializeSequence(reader, values.data(), size, std::true_type{});
+    }
+    static void readValues(byte_reader& reader, std::vector<T>& values, std::size_t size, std::false_type)
+    {
+        values.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values.push_back(serializer<T>::read(reader));
+        }
+    }
+};
+
+template <typename T>
+void serialize(byte_writer& writer, T const& value)
+{
+    serializer<T>::write(writer, value);
+}
+
+template <typename T>
+FLUENT_NODISCARD T deserialize(byte_reader& reader)
+{
+    return serializer<T>::read(reader);
+}
+
+// Contiguous sequences of values, copied with a single memcpy when their type is trivially serializable
+template <typename T>
+void serialize(byte_writer& writer, T const* values, std::size_t count)
+{
+    details::serializeSequence(writer, values, count, details::IsTriviallySerializable<T>{});
+}
+
+template <typename T>
+void deserialize(byte_reader& reader, T* values, std::size_t count)
+{
+    details::deserializeSequence(reader, values, count, details::IsTriviallySerializable<T>{});
+}
+
+// Versioned schemas: the version of the schema is written before the value. When reading a value written with an
+// older version, upgrade(reader, version) reads it instead of deserialize<T>. Newer versions throw std::runtime_error.
+template <typename T>
+void serialize_versioned(byte_writer& writer, T const& value, std::uint32_t version)
+{
+    serializer<std::uint32_t>::write(writer, version);
+    serializer<T>::write(writer, value);
+}
+
+template <typename T, typename Upgrade>
+FLUENT_NODISCARD T deserialize_versioned(byte_reader& reader, std::uint32_t currentVersion, Upgrade&& upgrade)
+{
+    std::uint32_t const version = serializer<std::uint32_t>::read(reader);
+    if (version == currentVersion)
+    {
+        return serializer<T>::read(reader);
+    }
+    if (version > currentVersion)
+    {
+        throw std::runtime_error("fluent::deserialize_versioned: value written with a newer schema");
+    }
+    return std::forward<Upgrade>(upgrade)(reader, version);
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef SHARDED_COUNTER_HPP
+#define SHARDED_COUNTER_HPP
+
+#include "cache_aligned.hpp"
+#include "named_type_impl.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace fluent
+{
+
+namespace details
+{
+
+// Index of the calling thread, given to threads in the order they first call this function
+inline std::size_t threadIndex() noexcept
+{
+    static std::atomic<std::size_t> threadCount{0};
+    thread_local std::size_t const index = threadCount.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace details
+
+// Counter of a strong type over an integral type, for counters incremented concurrently by many threads.
+// Each thread increments one of Shards atomic values, on its own cache line, so that threads don't contend on the same
+// cache line as long as there are fewer threads than shards. Reading the counter sums the shards: the result is not a
+// snapshot at one instant if threads increment the counter during the read.
+template <typename Strong, std::size_t Shards = 16>
+class sharded_counter
+{
+public:
+    using value_type = Strong;
+    using underlying_type = std::remove_reference_t<typename Strong::UnderlyingType>;
+    static_assert(std::is_integral<underlying_type>::value, "sharded_counter requires an integral underlying type");
+    static_assert(Shards > 0, "sharded_counter needs at least one shard");
+
+    sharded_counter() noexcept : shards_()
+    {
+    }
+    sharded_counter(sharded_counter const&) = delete;
+    sharded_counter& operator=(sharded_counter const&) = delete;
+
+    void add(Strong const& amount) noexcept
+    {
+        shards_[details::threadIndex() % Shards].value.fetch_add(amount.get(), std::memory_order_relaxed);
+    }
+    sharded_counter& operator+=(Strong const& amount) noexcept
+    {
+        add(amount);
+        return *this;
+    }
+    sharded_counter& operator++() noexcept
+    {
+        add(Strong(underlying_type{1}));
+        return *this;
+    }
+
+    FLUENT_NODISCARD Strong load() const noexcept
+    {
+        underlying_type total{};
+        for (Shard const& shard : shards_)
+        {
+            total = static_cast<underlying_type>(total + shard.value.load(std::memory_order_relaxed));
+        }
+        return Strong(total);
+    }
+
+    // Not atomic: the increments made concurrently can be lost
+    void reset() noexcept
+    {
+        for (Shard& shard : shards_)
+        {
+            shard.value.store(underlying_type{}, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(cache_line_size) Shard
+    {
+        std::atomic<underlying_type> value;
+    };
+
+    Shard shards_[Shards];
+};
+
+} // namespace fluent
+
+#endif
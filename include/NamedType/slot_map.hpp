@@ -0,0 +1,241 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// Container issuing a strong handle for each inserted value. A handle packs the index of a slot in its low IndexBits
+// bits and the generation of this slot in its other bits. Erasing a value increments the generation of its slot, so
+// that the handles to the erased value are rejected even after the slot is reused. A slot whose generation has reached
+// its largest value is retired instead of wrapping around to generations of older handles, which would accept them
+// again: it is never reused, and takes no more than its 2 integers.
+// The values are stored contiguously, so that iterating over them is as fast as over a std::vector, and lookups go
+// through the slot array, without hashing. Erasing moves the last value into the place of the erased one, so the order
+// of iteration is not the order of insertion.
+template <typename Handle,
+          typename Value,
+          int IndexBits = std::numeric_limits<std::remove_reference_t<typename Handle::UnderlyingType>>::digits / 4 * 3>
+class slot_map
+{
+public:
+    using handle_type = Handle;
+    using value_type = Value;
+    using size_type = std::size_t;
+    using reference = Value&;
+    using const_reference = Value const&;
+    using iterator = typename std::vector<Value>::iterator;
+    using const_iterator = typename std::vector<Value>::const_iterator;
+
+private:
+    using Underlying = std::remove_reference_t<typename Handle::UnderlyingType>;
+    static_assert(std::is_unsigned<Underlying>::value, "slot_map requires handles over an unsigned integral type");
+    static_assert(IndexBits > 0 && IndexBits < std::numeric_limits<Underlying>::digits,
+                  "handles need bits for both the index and the generation");
+
+    static constexpr Underlying indexMask = static_cast<Underlying>((Underlying{1} << IndexBits) - 1u);
+    static constexpr Underlying generationMask = static_cast<Underlying>(
+        std::numeric_limits<Underlying>::max() >> IndexBits);
+    static constexpr Underlying noSlot = indexMask;
+
+    struct Slot
+    {
+        // Position of the value in values_ for an occupied slot, next free slot otherwise
+        Underlying position;
+        Underlying generation;
+    };
+
+public:
+    // The largest number of values a slot_map can hold
+    static constexpr size_type max_slots = indexMask;
+
+    slot_map() : values_(), slotOfPositions_(), slots_(), freeSlot_(noSlot)
+    {
+    }
+
+    // lookup
+    FLUENT_NODISCARD bool contains(Handle const& handle) const noexcept
+    {
+        Underlying const slot = indexOf(handle);
+        if (slot >= slots_.size() || slots_[slot].generation != generationOf(handle))
+        {
+            return false;
+        }
+        // Rejects the handles forged with the generation of a free slot
+        Underlying const position = slots_[slot].position;
+        return position < values_.size() && slotOfPositions_[position] == slot;
+    }
+    // nullptr if the handle is stale
+    FLUENT_NODISCARD Value* find(Handle const& handle) noexcept
+    {
+        return contains(handle) ? &values_[slots_[indexOf(handle)].position] : nullptr;
+    }
+    FLUENT_NODISCARD Value const* find(Handle const& handle) const noexcept
+    {
+        return contains(handle) ? &values_[slots_[indexOf(handle)].position] : nullptr;
+    }
+    FLUENT_NODISCARD reference operator[](Handle const& handle) noexcept
+    {
+        FLUENT_ASSERT(contains(handle));
+        return values_[slots_[indexOf(handle)].position];
+    }
+    FLUENT_NODISCARD const_reference operator[](Handle const& handle) const noexcept
+    {
+        FLUENT_ASSERT(contains(handle));
+        return values_[slots_[indexOf(handle)].position];
+    }
+    FLUENT_NODISCARD reference at(Handle const& handle)
+    {
+        Value* const value = find(handle);
+        return value ? *value : throw std::out_of_range("fluent::slot_map: stale handle");
+    }
+    FLUENT_NODISCARD const_reference at(Handle const& handle) const
+    {
+        Value const* const value = find(handle);
+        return value ? *value : throw std::out_of_range("fluent::slot_map: stale handle");
+    }
+
+    // iterators over the values
+    FLUENT_NODISCARD iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD iterator end() noexcept
+    {
+        return values_.end();
+    }
+    FLUENT_NODISCARD const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+    // Handle of the value at a position of the iteration
+    FLUENT_NODISCARD Handle handle_at(size_type position) const noexcept
+    {
+        Underlying const slot = slotOfPositions_[position];
+        return makeHandle(slot, slots_[slot].generation);
+    }
+
+    // capacity
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return values_.size();
+    }
+    void reserve(size_type capacity)
+    {
+        values_.reserve(capacity);
+        slotOfPositions_.reserve(capacity);
+        slots_.reserve(capacity);
+    }
+
+    // modifiers
+    Handle insert(Value const& value)
+    {
+        return emplace(value);
+    }
+    Handle insert(Value&& value)
+    {
+        return emplace(std::move(value));
+    }
+    template <typename... Args>
+    Handle emplace(Args&&... args)
+    {
+        if (freeSlot_ == noSlot && slots_.size() == max_slots)
+        {
+            throw std::length_error("fluent::slot_map: no more slots for the handles");
+        }
+        if (freeSlot_ == noSlot)
+        {
+            slots_.push_back(Slot{noSlot, 0});
+            freeSlot_ = static_cast<Underlying>(slots_.size() - 1);
+        }
+        Underlying const slot = freeSlot_;
+        slotOfPositions_.push_back(slot);
+        try
+        {
+            values_.emplace_back(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            slotOfPositions_.pop_back();
+            throw;
+        }
+        freeSlot_ = slots_[slot].position;
+        slots_[slot].position = static_cast<Underlying>(values_.size() - 1);
+        return makeHandle(slot, slots_[slot].generation);
+    }
+    // Returns false if the handle is stale
+    bool erase(Handle const& handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        Underlying const slot = indexOf(handle);
+        Underlying const position = slots_[slot].position;
+        Underlying const lastPosition = static_cast<Underlying>(values_.size() - 1);
+        if (position != lastPosition)
+        {
+            values_[position] = std::move(values_.back());
+            slotOfPositions_[position] = slotOfPositions_.back();
+            slots_[slotOfPositions_[position]].position = position;
+        }
+        values_.pop_back();
+        slotOfPositions_.pop_back();
+        if (slots_[slot].generation == generationMask)
+        {
+            slots_[slot].position = noSlot; // retired, and not occupied for contains
+            return true;
+        }
+        ++slots_[slot].generation;
+        slots_[slot].position = freeSlot_;
+        freeSlot_ = slot;
+        return true;
+    }
+    // Invalidates all the handles
+    void clear() noexcept
+    {
+        while (!values_.empty())
+        {
+            erase(handle_at(values_.size() - 1));
+        }
+    }
+
+private:
+    static constexpr Underlying indexOf(Handle const& handle) noexcept
+    {
+        return static_cast<Underlying>(handle.get() & indexMask);
+    }
+    static constexpr Underlying generationOf(Handle const& handle) noexcept
+    {
+        return static_cast<Underlying>(handle.get() >> IndexBits);
+    }
+    static constexpr Handle makeHandle(Underlying slot, Underlying generation) noexcept
+    {
+        return Handle(static_cast<Underlying>(slot | static_cast<Underlying>(generation << IndexBits)));
+    }
+
+    std::vector<Value> values_;
+    std::vector<Underlying> slotOfPositions_;
+    std::vector<Slot> slots_;
+    Underlying freeSlot_;
+};
+
+} // namespace fluent
+
+#endif
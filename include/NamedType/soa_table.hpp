@@ -0,0 +1,317 @@
+#ifndef SOA_TABLE_HPP
+#define SOA_TABLE_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// Table storing each of its field types in its own column, so that scanning a field only reads this field.
+// Fields are strong types, that identify their column:
+//
+//     fluent::soa_table<Price, Quantity, Timestamp> trades;
+//     trades.push_back(Price{...}, Quantity{...}, Timestamp{...});
+//     for (Price const& price : trades.column<Price>()) ...
+template <typename... Fields>
+class soa_table
+{
+    static_assert(details::AreDistinct<Fields...>::value, "the fields of a soa_table must have distinct types");
+
+    template <bool IsConst>
+    class row_proxy
+    {
+    public:
+        using table_type = std::conditional_t<IsConst, soa_table const, soa_table>;
+
+        constexpr row_proxy(table_type& table, std::size_t position) noexcept : table_(&table), position_(position)
+        {
+        }
+
+        // Const rows can be obtained from non-const ones
+        template <bool OtherIsConst, typename = std::enable_if_t<IsConst && !OtherIsConst>>
+        constexpr row_proxy(row_proxy<OtherIsConst> const& other) noexcept
+            : table_(other.table_), position_(other.position_)
+        {
+        }
+
+        template <typename Field>
+        FLUENT_NODISCARD decltype(auto) get() const noexcept
+        {
+            return table_->template column<Field>()[position_];
+        }
+
+        FLUENT_NODISCARD constexpr std::size_t position() const noexcept
+        {
+            return position_;
+        }
+
+        // Copies the fields of the row
+        FLUENT_NODISCARD std::tuple<Fields...> values() const
+        {
+            return std::tuple<Fields...>(get<Fields>()...);
+        }
+        // Rows convert to the value_type of the iterators, which is required by C++20 iterator concepts
+        operator std::tuple<Fields...>() const
+        {
+            return values();
+        }
+
+    private:
+        template <bool>
+        friend class row_proxy;
+
+        table_type* table_;
+        std::size_t position_;
+    };
+
+    template <bool IsConst>
+    class row_iterator
+    {
+    public:
+        // Dereferencing returns a value instead of a reference, which only input iterators may do before C++20
+        using iterator_category = std::input_iterator_tag;
+#if defined(__cpp_lib_ranges)
+        using iterator_concept = std::random_access_iterator_tag;
+#endif
+        using value_type = std::tuple<Fields...>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = row_proxy<IsConst>;
+        using table_type = typename row_proxy<IsConst>::table_type;
+
+        row_iterator() = default;
+        constexpr row_iterator(table_type& table, std::size_t position) noexcept
+            : table_(&table), position_(position)
+        {
+        }
+
+        FLUENT_NODISCARD constexpr reference operator*() const noexcept
+        {
+            return reference(*table_, position_);
+        }
+        FLUENT_NODISCARD constexpr reference operator[](difference_type offset) const noexcept
+        {
+            return reference(*table_, position_ + static_cast<std::size_t>(offset));
+        }
+
+        FLUENT_CONSTEXPR17 row_iterator& operator++() noexcept
+        {
+            ++position_;
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 row_iterator operator++(int) noexcept
+        {
+            row_iterator const old = *this;
+            ++position_;
+            return old;
+        }
+        FLUENT_CONSTEXPR17 row_iterator& operator--() noexcept
+        {
+            --position_;
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 row_iterator operator--(int) noexcept
+        {
+            row_iterator const old = *this;
+            --position_;
+            return old;
+        }
+        FLUENT_CONSTEXPR17 row_iterator& operator+=(difference_type offset) noexcept
+        {
+            position_ += static_cast<std::size_t>(offset);
+            return *this;
+        }
+        FLUENT_CONSTEXPR17 row_iterator& operator-=(difference_type offset) noexcept
+        {
+            position_ -= static_cast<std::size_t>(offset);
+            return *this;
+        }
+        FLUENT_NODISCARD friend constexpr row_iterator operator+(row_iterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+        FLUENT_NODISCARD friend constexpr row_iterator operator+(difference_type offset, row_iterator it) noexcept
+        {
+            return it += offset;
+        }
+        FLUENT_NODISCARD friend constexpr row_iterator operator-(row_iterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+        FLUENT_NODISCARD friend constexpr difference_type operator-(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.position_) - static_cast<difference_type>(rhs.position_);
+        }
+        FLUENT_NODISCARD friend constexpr bool operator==(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ == rhs.position_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator!=(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ != rhs.position_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator<(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ < rhs.position_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator>(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ > rhs.position_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator<=(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ <= rhs.position_;
+        }
+        FLUENT_NODISCARD friend constexpr bool operator>=(row_iterator lhs, row_iterator rhs) noexcept
+        {
+            return lhs.position_ >= rhs.position_;
+        }
+
+    private:
+        table_type* table_ = nullptr;
+        std::size_t position_ = 0;
+    };
+
+public:
+    using row_reference = row_proxy<false>;
+    using const_row_reference = row_proxy<true>;
+    using iterator = row_iterator<false>;
+    using const_iterator = row_iterator<true>;
+    using size_type = std::size_t;
+
+    soa_table() : columns_()
+    {
+    }
+
+    // columns
+    template <typename Field>
+    FLUENT_NODISCARD std::vector<Field>& column() noexcept
+    {
+        static_assert(details::CountOf<Field, Fields...>::value == 1, "this field is not in the soa_table");
+        return std::get<std::vector<Field>>(columns_);
+    }
+    template <typename Field>
+    FLUENT_NODISCARD std::vector<Field> const& column() const noexcept
+    {
+        static_assert(details::CountOf<Field, Fields...>::value == 1, "this field is not in the soa_table");
+        return std::get<std::vector<Field>>(columns_);
+    }
+
+    // rows
+    FLUENT_NODISCARD row_reference operator[](size_type position) noexcept
+    {
+        return row_reference(*this, position);
+    }
+    FLUENT_NODISCARD const_row_reference operator[](size_type position) const noexcept
+    {
+        return const_row_reference(*this, position);
+    }
+    FLUENT_NODISCARD iterator begin() noexcept
+    {
+        return iterator(*this, 0);
+    }
+    FLUENT_NODISCARD iterator end() noexcept
+    {
+        return iterator(*this, size());
+    }
+    FLUENT_NODISCARD const_iterator begin() const noexcept
+    {
+        return const_iterator(*this, 0);
+    }
+    FLUENT_NODISCARD const_iterator end() const noexcept
+    {
+        return const_iterator(*this, size());
+    }
+
+    // capacity
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return std::get<0>(columns_).size();
+    }
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    void reserve(size_type capacity)
+    {
+        forEachColumn([capacity](auto& column) { column.reserve(capacity); });
+    }
+
+    // modifiers
+    // The fields can be passed in any order, as they are identified by their types.
+    // If a field throws, the columns that already grew are shrunk back, so that all columns keep the same size.
+    template <typename... Values>
+    void push_back(Values&&... values)
+    {
+        static_assert(sizeof...(Values) == sizeof...(Fields), "push_back takes one value for each field");
+        static_assert(
+            details::AreDistinct<std::decay_t<Values>...>::value, "push_back takes one value for each field");
+        size_type const oldSize = size();
+        try
+        {
+            using expand = int[];
+            static_cast<void>(
+                expand{0, (column<std::decay_t<Values>>().push_back(std::forward<Values>(values)), 0)...});
+        }
+        catch (...)
+        {
+            truncate(oldSize);
+            throw;
+        }
+    }
+    void pop_back()
+    {
+        forEachColumn([](auto& column) { column.pop_back(); });
+    }
+    void resize(size_type count)
+    {
+        size_type const oldSize = size();
+        try
+        {
+            forEachColumn([count](auto& column) { column.resize(count); });
+        }
+        catch (...)
+        {
+            truncate(oldSize);
+            throw;
+        }
+    }
+    void clear() noexcept
+    {
+        forEachColumn([](auto& column) { column.clear(); });
+    }
+
+private:
+    // Removes the rows past count from the columns longer than count, which doesn't require the fields to be
+    // default constructible or assignable
+    void truncate(size_type count) noexcept
+    {
+        forEachColumn([count](auto& column) {
+            while (column.size() > count)
+            {
+                column.pop_back();
+            }
+        });
+    }
+
+    template <typename Function>
+    void forEachColumn(Function function)
+    {
+        using expand = int[];
+        static_cast<void>(expand{0, (function(column<Fields>()), 0)...});
+    }
+
+    std::tuple<std::vector<Fields>...> columns_;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef STRONG_VECTOR_HPP
+#define STRONG_VECTOR_HPP
+
+#include "iota.hpp"
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+namespace details
+{
+
+template <typename Index>
+constexpr std::size_t toPosition(Index const& index) noexcept
+{
+    return static_cast<std::size_t>(index.get());
+}
+
+template <typename Index>
+constexpr Index toIndex(std::size_t position) noexcept
+{
+    return Index(static_cast<std::remove_reference_t<typename Index::UnderlyingType>>(position));
+}
+
+} // namespace details
+
+// Contiguous container that can only be indexed by the strong type Index.
+// operator[] checks its bounds in debug builds only, and at() always checks them.
+template <typename Index, typename Value, typename Allocator = std::allocator<Value>>
+class StrongVector
+{
+public:
+    using index_type = Index;
+    using value_type = Value;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value&;
+    using const_reference = Value const&;
+    using iterator = typename std::vector<Value, Allocator>::iterator;
+    using const_iterator = typename std::vector<Value, Allocator>::const_iterator;
+
+    StrongVector() = default;
+
+    explicit StrongVector(size_type count) : values_(count)
+    {
+    }
+
+    StrongVector(size_type count, Value const& value) : values_(count, value)
+    {
+    }
+
+    StrongVector(std::initializer_list<Value> values) : values_(values)
+    {
+    }
+
+    template <typename InputIterator>
+    StrongVector(InputIterator first, InputIterator last) : values_(first, last)
+    {
+    }
+
+    // element access
+    FLUENT_NODISCARD reference operator[](Index const& index) noexcept
+    {
+        FLUENT_ASSERT(contains(index));
+        return values_[details::toPosition(index)];
+    }
+    FLUENT_NODISCARD const_reference operator[](Index const& index) const noexcept
+    {
+        FLUENT_ASSERT(contains(index));
+        return values_[details::toPosition(index)];
+    }
+    FLUENT_NODISCARD reference at(Index const& index)
+    {
+        return values_.at(details::toPosition(index));
+    }
+    FLUENT_NODISCARD const_reference at(Index const& index) const
+    {
+        return values_.at(details::toPosition(index));
+    }
+    FLUENT_NODISCARD reference front() noexcept
+    {
+        return values_.front();
+    }
+    FLUENT_NODISCARD const_reference front() const noexcept
+    {
+        return values_.front();
+    }
+    FLUENT_NODISCARD reference back() noexcept
+    {
+        return values_.back();
+    }
+    FLUENT_NODISCARD const_reference back() const noexcept
+    {
+        return values_.back();
+    }
+    FLUENT_NODISCARD Value* data() noexcept
+    {
+        return values_.data();
+    }
+    FLUENT_NODISCARD Value const* data() const noexcept
+    {
+        return values_.data();
+    }
+
+    // indices
+    FLUENT_NODISCARD bool contains(Index const& index) const noexcept
+    {
+        return details::toPosition(index) < values_.size();
+    }
+    FLUENT_NODISCARD iota_range<Index> indices() const noexcept
+    {
+        return iota(details::toIndex<Index>(0), next_index());
+    }
+    // Index of the next element to be inserted at the back
+    FLUENT_NODISCARD Index next_index() const noexcept
+    {
+        return details::toIndex<Index>(values_.size());
+    }
+
+    // iterators
+    FLUENT_NODISCARD iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+    FLUENT_NODISCARD iterator end() noexcept
+    {
+        return values_.end();
+    }
+    FLUENT_NODISCARD const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+    // capacity
+    FLUENT_NODISCARD bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+    FLUENT_NODISCARD size_type size() const noexcept
+    {
+        return values_.size();
+    }
+    FLUENT_NODISCARD size_type capacity() const noexcept
+    {
+        return values_.capacity();
+    }
+    void reserve(size_type capacity)
+    {
+        values_.reserve(capacity);
+    }
+
+    // modifiers
+    void clear() noexcept
+    {
+        values_.clear();
+    }
+    // Returns the index of the inserted element
+    Index push_back(Value const& value)
+    {
+        values_.push_back(value);
+        return details::toIndex<Index>(values_.size() - 1);
+    }
+    Index push_back(Value&& value)
+    {
+        values_.push_back(std::move(value));
+        return details::toIndex<Index>(values_.size() - 1);
+    }
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        values_.emplace_back(std::forward<Args>(args)...);
+        return values_.back();
+    }
+    void pop_back() noexcept
+    {
+        values_.pop_back();
+    }
+    void resize(size_type count)
+    {
+        values_.resize(count);
+    }
+    void resize(size_type count, Value const& value)
+    {
+        values_.resize(count, value);
+    }
+
+    // The underlying std::vector, indexed by plain integers
+    FLUENT_NODISCARD std::vector<Value, Allocator>& vector() noexcept
+    {
+        return values_;
+    }
+    FLUENT_NODISCARD std::vector<Value, Allocator> const& vector() const noexcept
+    {
+        return values_;
+    }
+
+    FLUENT_NODISCARD friend bool operator==(StrongVector const& lhs, StrongVector const& rhs)
+    {
+        return lhs.values_ == rhs.values_;
+    }
+    FLUENT_NODISCARD friend bool operator!=(StrongVector const& lhs, StrongVector const& rhs)
+    {
+        return lhs.values_ != rhs.values_;
+    }
+
+private:
+    std::vector<Value, Allocator> values_;
+};
+
+} // namespace fluent
+
+#endif
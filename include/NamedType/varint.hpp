@@ -0,0 +1,224 @@
+#ifndef VARINT_HPP
+#define VARINT_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+#include "serialization.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// Compact encoding of integers, on 7 bits per byte (LEB128): values below 128 take one byte, and 64-bit values take up
+// to 10 bytes. The high bit of each byte tells whether another byte follows.
+// Signed values are zigzag encoded first (0, -1, 1, -2... become 0, 1, 2, 3...), so that small negative values are
+// small too.
+
+namespace fluent
+{
+
+// Makes fluent::serialize and fluent::deserialize encode the strong type as a varint, even if it is also Serializable
+template <typename T>
+struct VarintEncodable : crtp<T, VarintEncodable>
+{
+};
+
+constexpr std::size_t max_varint_size = 10;
+
+namespace details
+{
+
+template <typename Strong>
+using VarintUnderlying = std::remove_reference_t<typename Strong::UnderlyingType>;
+
+template <typename Strong>
+constexpr bool checkVarintUnderlying() noexcept
+{
+    static_assert(std::is_integral<VarintUnderlying<Strong>>::value, "varints require an integral underlying type");
+    return true;
+}
+
+template <typename Integer>
+constexpr std::uint64_t zigzag(Integer value, std::true_type) noexcept
+{
+    // The arithmetic shift spreads the sign bit over the whole word
+    return (static_cast<std::uint64_t>(value) << 1)
+           ^ static_cast<std::uint64_t>(static_cast<std::int64_t>(value) >> 63);
+}
+template <typename Integer>
+constexpr std::uint64_t zigzag(Integer value, std::false_type) noexcept
+{
+    return static_cast<std::uint64_t>(value);
+}
+
+template <typename Integer>
+Integer unzigzag(std::uint64_t bits, std::true_type)
+{
+    std::int64_t const value = static_cast<std::int64_t>((bits >> 1) ^ (0 - (bits & 1)));
+    if (value < static_cast<std::int64_t>(std::numeric_limits<Integer>::min())
+        || value > static_cast<std::int64_t>(std::numeric_limits<Integer>::max()))
+    {
+        throw std::out_of_range("fluent::decode_varint: value out of the range of the type");
+    }
+    return static_cast<Integer>(value);
+}
+template <typename Integer>
+Integer unzigzag(std::uint64_t bits, std::false_type)
+{
+    if (bits > static_cast<std::uint64_t>(std::numeric_limits<Integer>::max()))
+    {
+        throw std::out_of_range("fluent::decode_varint: value out of the range of the type");
+    }
+    return static_cast<Integer>(bits);
+}
+
+template <typename Strong>
+constexpr std::uint64_t toVarintBits(Strong const& value) noexcept
+{
+    using Underlying = VarintUnderlying<Strong>;
+    return zigzag(value.get(), std::integral_constant<bool, std::is_signed<Underlying>::value>{});
+}
+
+template <typename Strong>
+Strong fromVarintBits(std::uint64_t bits)
+{
+    using Underlying = VarintUnderlying<Strong>;
+    return Strong(unzigzag<Underlying>(bits, std::integral_constant<bool, std::is_signed<Underlying>::value>{}));
+}
+
+// Writes at most max_varint_size bytes, and returns how many
+inline std::size_t encodeVarint(std::uint64_t bits, unsigned char* bytes) noexcept
+{
+    std::size_t size = 0;
+    while (bits >= 0x80)
+    {
+        bytes[size++] = static_cast<unsigned char>(bits | 0x80);
+        bits >>= 7;
+    }
+    bytes[size++] = static_cast<unsigned char>(bits);
+    return size;
+}
+
+// Returns the number of bytes read
+inline std::size_t decodeVarint(unsigned char const* bytes, std::size_t available, std::uint64_t& bits)
+{
+    // Values below 128 first, as they are the reason for using varints
+    if (available > 0 && bytes[0] < 0x80)
+    {
+        bits = bytes[0];
+        return 1;
+    }
+    std::size_t const size = available < max_varint_size ? available : max_varint_size;
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        value |= static_cast<std::uint64_t>(bytes[i] & 0x7Fu) << (7 * i);
+        if (bytes[i] < 0x80)
+        {
+            // The last byte of a 64-bit value only holds its top bit
+            if (i == max_varint_size - 1 && bytes[i] > 1)
+            {
+                throw std::out_of_range("fluent::decode_varint: value larger than 64 bits");
+            }
+            bits = value;
+            return i + 1;
+        }
+    }
+    if (size == max_varint_size)
+    {
+        throw std::out_of_range("fluent::decode_varint: varint longer than 10 bytes");
+    }
+    throw std::out_of_range("fluent::byte_reader: not enough bytes");
+}
+
+} // namespace details
+
+// Number of bytes of the varint encoding of value
+template <typename Strong>
+FLUENT_NODISCARD constexpr std::size_t varint_size(Strong const& value) noexcept
+{
+    static_cast<void>(details::checkVarintUnderlying<Strong>());
+    std::uint64_t bits = details::toVarintBits(value);
+    std::size_t size = 1;
+    while (bits >= 0x80)
+    {
+        bits >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+template <typename Strong>
+void encode_varint(byte_writer& writer, Strong const& value)
+{
+    static_cast<void>(details::checkVarintUnderlying<Strong>());
+    unsigned char bytes[max_varint_size];
+    writer.write(bytes, details::encodeVarint(details::toVarintBits(value), bytes));
+}
+
+// Throws std::out_of_range on truncated or malformed bytes, and on values that don't fit in the underlying type
+template <typename Strong>
+FLUENT_NODISCARD Strong decode_varint(byte_reader& reader)
+{
+    static_cast<void>(details::checkVarintUnderlying<Strong>());
+    std::uint64_t bits = 0;
+    reader.skip(details::decodeVarint(reader.data(), reader.remaining(), bits));
+    return details::fromVarintBits<Strong>(bits);
+}
+
+// Contiguous sequences of values, encoded in a stack buffer that is appended to the writer in one go every 64 values
+template <typename Strong>
+void encode_varints(byte_writer& writer, Strong const* values, std::size_t count)
+{
+    static_cast<void>(details::checkVarintUnderlying<Strong>());
+    constexpr std::size_t valuesPerChunk = 64;
+    unsigned char bytes[valuesPerChunk * max_varint_size];
+    while (count > 0)
+    {
+        std::size_t const chunk = count < valuesPerChunk ? count : valuesPerChunk;
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < chunk; ++i)
+        {
+            size += details::encodeVarint(details::toVarintBits(values[i]), bytes + size);
+        }
+        writer.write(bytes, size);
+        values += chunk;
+        count -= chunk;
+    }
+}
+
+// Decodes in place in the bytes of the reader, that only moves past them if all values are valid
+template <typename Strong>
+void decode_varints(byte_reader& reader, Strong* values, std::size_t count)
+{
+    static_cast<void>(details::checkVarintUnderlying<Strong>());
+    unsigned char const* const bytes = reader.data();
+    std::size_t const available = reader.remaining();
+    std::size_t position = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::uint64_t bits = 0;
+        position += details::decodeVarint(bytes + position, available - position, bits);
+        values[i] = details::fromVarintBits<Strong>(bits);
+    }
+    reader.skip(position);
+}
+
+template <typename T>
+struct serializer<T, std::enable_if_t<details::IsVarintEncodable<T>::value>>
+{
+    static void write(byte_writer& writer, T const& value)
+    {
+        encode_varint(writer, value);
+    }
+    static T read(byte_reader& reader)
+    {
+        return decode_varint<T>(reader);
+    }
+};
+
+} // namespace fluent
+
+#endif
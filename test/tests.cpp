@@ -6,13 +6,44 @@
 
 #include "catch.hpp"
 
+#include "NamedType/atomic.hpp"
+#include "NamedType/bitpack.hpp"
+#include "NamedType/bounded.hpp"
+#include "NamedType/byte_order.hpp"
+#include "NamedType/column_file.hpp"
+#include "NamedType/decimal.hpp"
+#include "NamedType/delta_column.hpp"
+#include "NamedType/id_generator.hpp"
+#include "NamedType/iota.hpp"
 #include "NamedType/named_type.hpp"
-
+#include "NamedType/offset_ptr.hpp"
+#include "NamedType/optional.hpp"
+#include "NamedType/prefix_comparable.hpp"
+#include "NamedType/radix_sort.hpp"
+#include "NamedType/record.hpp"
+#include "NamedType/seqlocked.hpp"
+#include "NamedType/serialization.hpp"
+#include "NamedType/sharded_counter.hpp"
+#include "NamedType/slot_map.hpp"
+#include "NamedType/soa_table.hpp"
+#include "NamedType/strong_vector.hpp"
+#include "NamedType/varint.hpp"
+
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -901,6 +932,15 @@ TEST_CASE("Named arguments with bracket constructor")
 TEST_CASE("Empty base class optimization")
 {
     REQUIRE(sizeof(Meter) == sizeof(double));
+
+    using Inner = fluent::NamedType<int, struct InnerTag>;
+    struct InnerAndInt
+    {
+        Inner inner;
+        int other;
+    };
+    REQUIRE(sizeof(fluent::NamedType<Inner, struct OuterTag>) == sizeof(int));
+    REQUIRE(sizeof(fluent::NamedType<InnerAndInt, struct OuterTag>) == 2 * sizeof(int));
 }
 
 using strong_int = fluent::NamedType<int, struct IntTag>;
@@ -1170,6 +1210,1735 @@ TEST_CASE("Empty base class optimisation of skills")
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Incrementable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Decrementable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::Arithmetic>));
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::CheckedArithmetic>));
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::SaturatingArithmetic>));
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::SerialNumber>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::PreIncrementable>));
     CHECK(sizeof(int) == sizeof(SkilledType<fluent::PreIncrementable>));
 }
+
+TEST_CASE("CheckedArithmetic")
+{
+    using StrongInt = fluent::NamedType<int8_t, struct StrongIntTag, fluent::CheckedArithmetic>;
+    StrongInt a{100};
+    CHECK((a + StrongInt{27}).get() == 127);
+    CHECK((a - StrongInt{-27}).get() == 127);
+    CHECK((StrongInt{-64} * StrongInt{2}).get() == -128);
+
+    CHECK_THROWS_AS(a + StrongInt{28}, std::overflow_error);
+    CHECK_THROWS_AS(StrongInt{-100} - StrongInt{29}, std::overflow_error);
+    CHECK_THROWS_AS(StrongInt{64} * StrongInt{2}, std::overflow_error);
+    CHECK_THROWS_AS(-StrongInt{-128}, std::overflow_error);
+
+    CHECK_THROWS_AS(a += StrongInt{100}, std::overflow_error);
+    CHECK(a.get() == 100);
+
+    StrongInt max{127};
+    CHECK_THROWS_AS(++max, std::overflow_error);
+    CHECK_THROWS_AS(max++, std::overflow_error);
+    CHECK(max.get() == 127);
+    CHECK((--max).get() == 126);
+    CHECK((max--).get() == 126);
+    CHECK(max.get() == 125);
+}
+
+TEST_CASE("CheckedArithmetic constexpr")
+{
+    using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::CheckedArithmetic>;
+    static_assert((StrongInt{1} + StrongInt{2}).get() == 3, "CheckedArithmetic is not constexpr");
+    static_assert((StrongInt{1} - StrongInt{2}).get() == -1, "CheckedArithmetic is not constexpr");
+    static_assert((StrongInt{3} * StrongInt{2}).get() == 6, "CheckedArithmetic is not constexpr");
+}
+
+TEST_CASE("CheckedArithmetic with flag policy")
+{
+    using StrongUnsigned = fluent::
+        NamedType<unsigned, struct StrongUnsignedTag, fluent::CheckedArithmeticWith<fluent::FlagOnOverflow>::templ>;
+    fluent::FlagOnOverflow::clear();
+
+    StrongUnsigned a{1};
+    a -= StrongUnsigned{1};
+    CHECK(!fluent::FlagOnOverflow::raised());
+
+    --a;
+    CHECK(fluent::FlagOnOverflow::raised());
+    CHECK(a.get() == std::numeric_limits<unsigned>::max());
+
+    fluent::FlagOnOverflow::clear();
+    CHECK(!fluent::FlagOnOverflow::raised());
+}
+
+TEST_CASE("SaturatingArithmetic")
+{
+    using StrongUnsigned = fluent::NamedType<uint8_t, struct StrongUnsignedTag, fluent::SaturatingArithmetic>;
+    CHECK((StrongUnsigned{200} + StrongUnsigned{100}).get() == 255);
+    CHECK((StrongUnsigned{100} - StrongUnsigned{200}).get() == 0);
+    CHECK((StrongUnsigned{16} * StrongUnsigned{16}).get() == 255);
+    CHECK((StrongUnsigned{15} * StrongUnsigned{17}).get() == 255);
+    CHECK((StrongUnsigned{10} * StrongUnsigned{2}).get() == 20);
+
+    using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::SaturatingArithmetic>;
+    auto const max = std::numeric_limits<int>::max();
+    auto const min = std::numeric_limits<int>::min();
+    CHECK((StrongInt{max} + StrongInt{1}).get() == max);
+    CHECK((StrongInt{min} + StrongInt{-1}).get() == min);
+    CHECK((StrongInt{min} - StrongInt{1}).get() == min);
+    CHECK((StrongInt{max} - StrongInt{-1}).get() == max);
+    CHECK((StrongInt{max} * StrongInt{-2}).get() == min);
+    CHECK((StrongInt{min} * StrongInt{-2}).get() == max);
+    CHECK((StrongInt{-3} * StrongInt{4}).get() == -12);
+
+    StrongInt a{max};
+    CHECK((a++).get() == max);
+    CHECK((++a).get() == max);
+    a += StrongInt{max};
+    CHECK(a.get() == max);
+
+    StrongInt b{min};
+    CHECK((--b).get() == min);
+    b -= StrongInt{max};
+    CHECK(b.get() == min);
+    b *= StrongInt{2};
+    CHECK(b.get() == min);
+}
+
+TEST_CASE("SaturatingArithmetic constexpr")
+{
+    using StrongUnsigned = fluent::NamedType<uint16_t, struct StrongUnsignedTag, fluent::SaturatingArithmetic>;
+    static_assert((StrongUnsigned{65000} + StrongUnsigned{1000}).get() == 65535, "SaturatingArithmetic is not constexpr");
+    static_assert((StrongUnsigned{1} - StrongUnsigned{2}).get() == 0, "SaturatingArithmetic is not constexpr");
+}
+
+TEST_CASE("SerialComparable")
+{
+    using SequenceNumber = fluent::NamedType<uint16_t, struct SequenceNumberTag, fluent::SerialComparable>;
+    CHECK(SequenceNumber{1} < SequenceNumber{2});
+    CHECK(SequenceNumber{65535} < SequenceNumber{0});
+    CHECK(SequenceNumber{65000} < SequenceNumber{100});
+    CHECK(SequenceNumber{100} > SequenceNumber{65000});
+    CHECK(!(SequenceNumber{100} < SequenceNumber{100}));
+    CHECK(SequenceNumber{100} <= SequenceNumber{100});
+    CHECK(SequenceNumber{100} >= SequenceNumber{100});
+    CHECK(SequenceNumber{65535} <= SequenceNumber{0});
+    CHECK(SequenceNumber{0} >= SequenceNumber{65535});
+    CHECK(SequenceNumber{7} == SequenceNumber{7});
+    CHECK(SequenceNumber{7} != SequenceNumber{8});
+
+    // Values half a range apart are neither less nor greater than each other
+    CHECK(!(SequenceNumber{0} < SequenceNumber{32768}));
+    CHECK(!(SequenceNumber{0} > SequenceNumber{32768}));
+    CHECK(SequenceNumber{0} < SequenceNumber{32767});
+    CHECK(SequenceNumber{32769} < SequenceNumber{0});
+}
+
+TEST_CASE("SerialComparable constexpr")
+{
+    using SequenceNumber = fluent::NamedType<uint32_t, struct SequenceNumberTag, fluent::SerialComparable>;
+    static_assert(SequenceNumber{0xFFFFFFFF} < SequenceNumber{1}, "SerialComparable is not constexpr");
+}
+
+TEST_CASE("WrappingIncrementable")
+{
+    using SequenceNumber = fluent::NamedType<uint16_t, struct SequenceNumberTag, fluent::SerialNumber>;
+    SequenceNumber a{65535};
+    CHECK((a++).get() == 65535);
+    CHECK(a.get() == 0);
+    CHECK((--a).get() == 65535);
+    CHECK((++a).get() == 0);
+    CHECK((a--).get() == 0);
+    CHECK(a.get() == 65535);
+    CHECK(a < ++SequenceNumber{a.get()});
+}
+
+TEST_CASE("serial_distance")
+{
+    using SequenceNumber = fluent::NamedType<uint16_t, struct SequenceNumberTag, fluent::SerialNumber>;
+    CHECK(fluent::serial_distance(SequenceNumber{10}, SequenceNumber{15}) == 5);
+    CHECK(fluent::serial_distance(SequenceNumber{15}, SequenceNumber{10}) == -5);
+    CHECK(fluent::serial_distance(SequenceNumber{65530}, SequenceNumber{4}) == 10);
+    CHECK(fluent::serial_distance(SequenceNumber{4}, SequenceNumber{65530}) == -10);
+    CHECK(fluent::serial_distance(SequenceNumber{0}, SequenceNumber{32767}) == 32767);
+    CHECK(fluent::serial_distance(SequenceNumber{0}, SequenceNumber{32768}) == -32768);
+    static_assert(fluent::serial_distance(SequenceNumber{1}, SequenceNumber{0}) == -1, "serial_distance is not constexpr");
+}
+
+TEST_CASE("find_first_gap")
+{
+    using SequenceNumber = fluent::NamedType<uint32_t, struct SequenceNumberTag, fluent::SerialNumber>;
+    std::vector<SequenceNumber> sequence;
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        sequence.push_back(SequenceNumber{0xFFFFFFF0u + i});
+    }
+    auto const first = sequence.data();
+    auto const last = sequence.data() + sequence.size();
+    CHECK(fluent::find_first_gap(first, last) == last);
+    CHECK(fluent::find_first_gap(first, first + 1) == first + 1);
+
+    sequence[70] = SequenceNumber{12345};
+    CHECK(fluent::find_first_gap(first, last) == first + 69);
+    sequence[3] = SequenceNumber{12345};
+    CHECK(fluent::find_first_gap(first, last) == first + 2);
+    sequence[99] = SequenceNumber{12345};
+    CHECK(fluent::find_first_gap(first + 71, last) == first + 98);
+}
+
+using Amount = fluent::Decimal<int64_t, 4>;
+
+TEST_CASE("Decimal arithmetic")
+{
+    CHECK((Amount::fromRaw(12345) + Amount::fromUnits(1)).raw() == 22345);
+    CHECK((Amount::fromUnits(1) - Amount::fromRaw(1)).raw() == 9999);
+    CHECK((-Amount::fromRaw(5)).raw() == -5);
+
+    // 1.5 * 2.25 = 3.375
+    CHECK((Amount::fromRaw(15000) * Amount::fromRaw(22500)).raw() == 33750);
+    // 0.0001 * 0.5 = 0.00005, rounded half away from zero
+    CHECK((Amount::fromRaw(1) * Amount::fromRaw(5000)).raw() == 1);
+    CHECK((Amount::fromRaw(-1) * Amount::fromRaw(5000)).raw() == -1);
+    CHECK((Amount::fromRaw(1) * Amount::fromRaw(4999)).raw() == 0);
+    // Products that overflow the representation before rescaling
+    CHECK((Amount::fromUnits(3000000000) * Amount::fromUnits(2)).raw() == Amount::fromUnits(6000000000).raw());
+
+    // 1 / 3 = 0.3333, 2 / 3 = 0.6667
+    CHECK((Amount::fromUnits(1) / Amount::fromUnits(3)).raw() == 3333);
+    CHECK((Amount::fromUnits(2) / Amount::fromUnits(3)).raw() == 6667);
+    CHECK((Amount::fromUnits(-2) / Amount::fromUnits(3)).raw() == -6667);
+    CHECK((Amount::fromUnits(7) % Amount::fromUnits(2)).raw() == 10000);
+
+    Amount a = Amount::fromUnits(1);
+    a += Amount::fromRaw(5000);
+    a *= Amount::fromUnits(2);
+    CHECK(a.raw() == 30000);
+    ++a;
+    CHECK(a == Amount::fromUnits(4));
+    CHECK(Amount::fromRaw(1) < Amount::fromRaw(2));
+}
+
+TEST_CASE("Decimal with a small representation")
+{
+    using Percentage = fluent::Decimal<int16_t, 2>;
+    // 1.50 * 1.50 = 2.25, computed in a wider type
+    CHECK((Percentage::fromRaw(150) * Percentage::fromRaw(150)).raw() == 225);
+    CHECK((Percentage::fromUnits(10) / Percentage::fromUnits(4)).raw() == 250);
+}
+
+TEST_CASE("Decimal products without a wide representation")
+{
+    // Platforms without a 128-bit integer rescale 64-bit products without one, even when the product doesn't fit in
+    // 64 bits. 1.5 * 10^12: the raw product 15000 * 10^16 overflows, but not the result.
+    using fluent::details::scaledProduct;
+    CHECK(scaledProduct(int64_t{15000}, int64_t{10000000000000000}, int64_t{10000}, std::false_type{})
+          == int64_t{15000000000000000});
+    CHECK(scaledProduct(uint64_t{15000}, uint64_t{10000000000000000}, uint64_t{10000}, std::false_type{})
+          == uint64_t{15000000000000000});
+    CHECK(scaledProduct(int64_t{-15000}, int64_t{3}, int64_t{10000}, std::false_type{}) == -5); // -4.5 rounds to -5
+    CHECK(scaledProduct(int64_t{10000}, int64_t{-7}, int64_t{3}, std::false_type{}) == -23333);
+
+#if defined(__SIZEOF_INT128__)
+    // Same results as through __int128
+    __extension__ typedef __int128 Wide;
+    int64_t const maxRaw = std::numeric_limits<int64_t>::max();
+    std::vector<int64_t> const values = {
+        0, 1, -1, 4999, 5000, -15000, 22500, 123456789, -987654321987, -3037000499, 9223372036854, maxRaw / 10000};
+    std::vector<int64_t> const divisors = {1, 3, -7, 10000, 1000000000, -99999999999, maxRaw};
+    for (int64_t const a : values)
+    {
+        for (int64_t const b : {int64_t{3}, int64_t{-10000}, int64_t{1000000000000}, maxRaw})
+        {
+            for (int64_t const c : divisors)
+            {
+                Wide const quotient = static_cast<Wide>(a) * b / c;
+                if (quotient >= maxRaw || quotient <= -maxRaw)
+                {
+                    continue; // the result overflows
+                }
+                CHECK(scaledProduct(a, b, c, std::false_type{}) == scaledProduct(a, b, c, std::true_type{}));
+            }
+        }
+    }
+#endif
+}
+
+TEST_CASE("Decimal constexpr")
+{
+    static_assert((Amount::fromRaw(15000) * Amount::fromRaw(22500)).raw() == 33750, "Decimal is not constexpr");
+    static_assert(Amount::fromDouble(-1.23456).raw() == -12346, "Decimal is not constexpr");
+    static_assert(Amount::scale == 10000, "Decimal is not constexpr");
+}
+
+TEST_CASE("Decimal conversions")
+{
+    CHECK(Amount::fromDouble(0.1).raw() == 1000);
+    CHECK(static_cast<double>(Amount::fromRaw(-2500)) == Approx(-0.25));
+
+    using Cents = fluent::Decimal<int64_t, 2>;
+    CHECK(fluent::decimal_cast<Cents>(Amount::fromRaw(12350)).raw() == 124);
+    CHECK(fluent::decimal_cast<Cents>(Amount::fromRaw(-12349)).raw() == -123);
+    CHECK(fluent::decimal_cast<Amount>(Cents::fromRaw(-5)).raw() == -500);
+}
+
+TEST_CASE("Decimal to_chars and from_chars")
+{
+    auto const toString = [](Amount value) {
+        char buffer[32];
+        auto const result = fluent::to_chars(buffer, buffer + sizeof(buffer), value);
+        REQUIRE(result.ec == std::errc{});
+        return std::string(buffer, result.ptr);
+    };
+    CHECK(toString(Amount::fromRaw(12345)) == "1.2345");
+    CHECK(toString(Amount::fromRaw(-5)) == "-0.0005");
+    CHECK(toString(Amount::fromUnits(0)) == "0.0000");
+    CHECK(toString(Amount::fromRaw(std::numeric_limits<int64_t>::min())) == "-922337203685477.5808");
+
+    char small[4];
+    CHECK(fluent::to_chars(small, small + sizeof(small), Amount::fromRaw(12345)).ec == std::errc::value_too_large);
+
+    auto const parse = [](std::string const& text, Amount& value) {
+        return fluent::from_chars(text.data(), text.data() + text.size(), value);
+    };
+    Amount value;
+    CHECK(parse("1.2345", value).ec == std::errc{});
+    CHECK(value.raw() == 12345);
+    CHECK(parse("-42", value).ec == std::errc{});
+    CHECK(value.raw() == -420000);
+    CHECK(parse(".5", value).ec == std::errc{});
+    CHECK(value.raw() == 5000);
+    CHECK(parse("0.123456", value).ec == std::errc{});
+    CHECK(value.raw() == 1235);
+    CHECK(parse("-922337203685477.5808", value).ec == std::errc{});
+    CHECK(value.raw() == std::numeric_limits<int64_t>::min());
+
+    std::string const trailing = "3.25 EUR";
+    auto const result = parse(trailing, value);
+    CHECK(result.ec == std::errc{});
+    CHECK(result.ptr == trailing.data() + 4);
+    CHECK(value.raw() == 32500);
+
+    CHECK(parse("922337203685477.5808", value).ec == std::errc::result_out_of_range);
+    CHECK(parse("abc", value).ec == std::errc::invalid_argument);
+    CHECK(parse("-.", value).ec == std::errc::invalid_argument);
+}
+
+TEST_CASE("Strong type over Decimal")
+{
+    using Price = fluent::NamedType<
+        Amount,
+        struct PriceTag,
+        fluent::Addable,
+        fluent::Multiplicable,
+        fluent::Comparable,
+        fluent::Printable,
+        fluent::Hashable>;
+    Price const price{Amount::fromRaw(19990)};
+    Price const total = price * Price{Amount::fromUnits(3)};
+    CHECK(total.get().raw() == 59970);
+    CHECK(price < total);
+
+    std::ostringstream os;
+    os << total;
+    CHECK(os.str() == "5.9970");
+
+    std::unordered_map<Price, int> map = {{price, 1}};
+    CHECK(map[price] == 1);
+    CHECK(sizeof(Price) == sizeof(int64_t));
+}
+
+TEST_CASE("Bounded storage")
+{
+    static_assert(std::is_same<fluent::Bounded<0, 100>::rep, uint8_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-1, 100>::rep, int8_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<0, 255>::rep, uint8_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<0, 256>::rep, uint16_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-200, 200>::rep, int16_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<0, 65536>::rep, uint32_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-1, 65536>::rep, int32_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<0, 0x100000000>::rep, uint64_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-1, 0x100000000>::rep, int64_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-10, -5>::rep, int8_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-1000, -1>::rep, int16_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-100000, -70000>::rep, int32_t>::value, "");
+    static_assert(std::is_same<fluent::Bounded<-0x100000000, -0x100000000>::rep, int64_t>::value, "");
+    static_assert(sizeof(fluent::Bounded<-10, -5>) == 1, "");
+
+    using Percentage = fluent::NamedType<fluent::Bounded<0, 100>, struct PercentageTag, fluent::Comparable>;
+    CHECK(sizeof(Percentage) == 1);
+    std::vector<Percentage> percentages(1000, Percentage{fluent::Bounded<0, 100>{}});
+    CHECK(percentages.front().get().value() == 0);
+}
+
+TEST_CASE("Bounded validation")
+{
+    using PortIndex = fluent::Bounded<1, 48>;
+    CHECK(PortIndex{1}.value() == 1);
+    CHECK(PortIndex{48}.value() == 48);
+    CHECK(PortIndex{}.value() == 1);
+    CHECK_THROWS_AS(PortIndex{0}, std::out_of_range);
+    CHECK_THROWS_AS(PortIndex{49}, std::out_of_range);
+    CHECK_THROWS_AS(PortIndex{-1000}, std::out_of_range);
+
+    PortIndex index{47};
+    CHECK((++index).value() == 48);
+    CHECK_THROWS_AS(++index, std::out_of_range);
+    CHECK(index.value() == 48);
+    CHECK_THROWS_AS(index + PortIndex{1}, std::out_of_range);
+    CHECK((index - PortIndex{40}).value() == 8);
+}
+
+TEST_CASE("Bounded arithmetic at the limits of intmax_t")
+{
+    constexpr std::intmax_t largest = std::numeric_limits<std::intmax_t>::max();
+    constexpr std::intmax_t smallest = std::numeric_limits<std::intmax_t>::min();
+    using Huge = fluent::Bounded<largest - 1, largest>;
+    Huge huge{largest};
+    CHECK_THROWS_AS(huge + Huge{largest - 1}, std::out_of_range); // overflows intmax_t
+    CHECK_THROWS_AS(++huge, std::out_of_range);
+    CHECK(huge.value() == largest);
+    CHECK((--huge).value() == largest - 1);
+
+    using Tiny = fluent::Bounded<smallest, smallest + 1>;
+    Tiny tiny{smallest};
+    CHECK_THROWS_AS(--tiny, std::out_of_range);
+    CHECK_THROWS_AS(tiny + Tiny{smallest}, std::out_of_range);
+    CHECK_THROWS_AS(Huge{largest} - Huge{largest - 1}, std::out_of_range); // 1, out of range without overflowing
+    using Wide = fluent::Bounded<smallest, largest>;
+    CHECK_THROWS_AS(Wide{largest} - Wide{-1}, std::out_of_range);
+    CHECK((Wide{largest} - Wide{largest}).value() == 0);
+}
+
+TEST_CASE("Bounded constexpr")
+{
+    static_assert(fluent::Bounded<-10, 10>{-10}.value() == -10, "Bounded is not constexpr");
+    static_assert(fluent::Bounded<-10, 10>{3} < fluent::Bounded<-10, 10>{4}, "Bounded is not constexpr");
+    static_assert(!fluent::Bounded<-10, 10>::contains(11), "Bounded is not constexpr");
+}
+
+TEST_CASE("Strong type over Bounded")
+{
+    using Percentage = fluent::NamedType<
+        fluent::Bounded<0, 100>,
+        struct PercentageTag,
+        fluent::Addable,
+        fluent::Comparable,
+        fluent::Printable,
+        fluent::Hashable>;
+    Percentage const a{fluent::Bounded<0, 100>{60}};
+    Percentage const b{fluent::Bounded<0, 100>{30}};
+    CHECK((a + b).get().value() == 90);
+    CHECK_THROWS_AS(a + a, std::out_of_range);
+    CHECK(b < a);
+
+    std::ostringstream os;
+    os << a;
+    CHECK(os.str() == "60");
+    CHECK(std::hash<Percentage>()(a) == std::hash<uint8_t>()(60));
+}
+
+TEST_CASE("NonZero")
+{
+    using Divisor = fluent::NamedType<int, struct DivisorTag, fluent::NonZero>;
+    CHECK_THROWS_AS(Divisor{0}, std::invalid_argument);
+    CHECK(!noexcept(Divisor{1}));
+    Divisor const divisor{4};
+    CHECK(17 / divisor == 4);
+    CHECK(17 % divisor == 1);
+    CHECK(-17 / divisor == -4);
+    static_assert(!std::is_default_constructible<Divisor>::value, "the default value would not be checked");
+    static_assert(std::is_trivially_default_constructible<strong_int>::value, "");
+}
+
+TEST_CASE("PowerOfTwo")
+{
+    using Capacity = fluent::NamedType<uint32_t, struct CapacityTag, fluent::PowerOfTwo, fluent::Comparable>;
+    CHECK_THROWS_AS(Capacity{0}, std::invalid_argument);
+    CHECK_THROWS_AS(Capacity{12}, std::invalid_argument);
+    CHECK_NOTHROW(Capacity{1});
+    CHECK_NOTHROW(Capacity{0x80000000u});
+
+    Capacity const capacity{16};
+    CHECK(capacity.log2() == 4);
+    CHECK(37u % capacity == 5u);
+    CHECK(37u / capacity == 2u);
+    CHECK(uint64_t{0x100000025} % capacity == 5u);
+    CHECK(capacity < Capacity{32});
+    static_assert(!std::is_default_constructible<Capacity>::value, "the default value would not be checked");
+}
+
+namespace
+{
+template <typename Dividend, typename Divisor, typename = void>
+struct IsDivisible : std::false_type
+{
+};
+template <typename Dividend, typename Divisor>
+struct IsDivisible<Dividend, Divisor, decltype(void(std::declval<Dividend>() / std::declval<Divisor>()))>
+    : std::true_type
+{
+};
+} // namespace
+
+TEST_CASE("PowerOfTwo only divides unsigned integers at least as wide")
+{
+    using Capacity = fluent::NamedType<uint32_t, struct CapacityTag, fluent::PowerOfTwo>;
+    static_assert(IsDivisible<uint32_t, Capacity>::value, "");
+    static_assert(IsDivisible<uint64_t, Capacity>::value, "");
+    static_assert(!IsDivisible<int32_t, Capacity>::value, "shifts round negative values towards minus infinity");
+    static_assert(!IsDivisible<uint16_t, Capacity>::value, "the shift could be as wide as the dividend");
+    CHECK(uint64_t{0x100000000} / Capacity{0x80000000u} == 2u);
+}
+
+TEST_CASE("PowerOfTwo constexpr")
+{
+    using Capacity = fluent::NamedType<uint32_t, struct CapacityTag, fluent::PowerOfTwo>;
+    static_assert(37u % Capacity{8} == 5u, "PowerOfTwo is not constexpr");
+    static_assert(37u / Capacity{8} == 4u, "PowerOfTwo is not constexpr");
+}
+
+TEST_CASE("Aligned")
+{
+    using Offset = fluent::NamedType<std::size_t, struct OffsetTag, fluent::Aligned<64>::templ>;
+    CHECK_THROWS_AS(Offset{65}, std::invalid_argument);
+    CHECK(Offset{128}.aligned() == 128);
+
+    alignas(32) float buffer[16] = {};
+    using AlignedPointer = fluent::NamedType<float*, struct AlignedPointerTag, fluent::Aligned<32>::templ>;
+    CHECK(AlignedPointer{buffer}.aligned() == buffer);
+    CHECK_THROWS_AS(AlignedPointer{buffer + 1}, std::invalid_argument);
+}
+
+TEST_CASE("Invariants are not checked for skills without invariants")
+{
+    static_assert(std::is_nothrow_constructible<strong_int, int>::value, "strong_int is not nothrow constructible");
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::NonZero>));
+    CHECK(sizeof(int) == sizeof(SkilledType<fluent::Aligned<4>::templ>));
+}
+
+TEST_CASE("Optional with a sentinel value")
+{
+    using OrderId = fluent::NamedType<uint32_t, struct OrderIdTag, fluent::EmptyIfZero, fluent::Comparable>;
+    static_assert(sizeof(fluent::optional<OrderId>) == sizeof(uint32_t), "fluent::optional has a flag");
+    static_assert(
+        std::is_trivially_copyable<fluent::optional<OrderId>>::value, "fluent::optional is not trivially copyable");
+
+    fluent::optional<OrderId> id;
+    CHECK(!id.has_value());
+    CHECK(!id);
+    CHECK(id == fluent::nullopt);
+    CHECK_THROWS_AS(id.value(), fluent::bad_optional_access);
+    CHECK(id.value_or(OrderId{7}).get() == 7);
+
+    id = OrderId{42};
+    CHECK(id.has_value());
+    CHECK(id != fluent::nullopt);
+    CHECK(id->get() == 42);
+    CHECK((*id).get() == 42);
+    CHECK(id.value() == OrderId{42});
+    CHECK(id == fluent::make_optional(OrderId{42}));
+
+    id.reset();
+    CHECK(!id);
+    CHECK(id.emplace(43u).get() == 43);
+    id = fluent::nullopt;
+    CHECK(id == fluent::optional<OrderId>{});
+
+    // Storing the sentinel value empties the optional
+    id = OrderId{0};
+    CHECK(!id);
+}
+
+TEST_CASE("Optional with max and NaN sentinels")
+{
+    using Index = fluent::NamedType<uint16_t, struct IndexTag, fluent::EmptyIfMax>;
+    fluent::optional<Index> index;
+    CHECK(!index);
+    CHECK(index->get() == std::numeric_limits<uint16_t>::max());
+    index = Index{0};
+    CHECK(index);
+
+    using Ratio = fluent::NamedType<double, struct RatioTag, fluent::EmptyIfNaN>;
+    static_assert(sizeof(fluent::optional<Ratio>) == sizeof(double), "fluent::optional has a flag");
+    fluent::optional<Ratio> ratio;
+    CHECK(!ratio);
+    CHECK(ratio == fluent::optional<Ratio>{});
+    ratio = Ratio{0.5};
+    CHECK(ratio.value().get() == Approx(0.5));
+}
+
+TEST_CASE("Optional in containers")
+{
+    using OrderId = fluent::NamedType<uint32_t, struct OrderIdTag, fluent::EmptyIfZero>;
+    std::vector<fluent::optional<OrderId>> ids(100);
+    ids[10] = OrderId{1};
+    ids[20] = OrderId{2};
+    auto const count =
+        std::count_if(ids.begin(), ids.end(), [](fluent::optional<OrderId> const& id) { return id.has_value(); });
+    CHECK(count == 2);
+
+    std::unordered_map<fluent::optional<OrderId>, int> map;
+    map[fluent::nullopt] = 1;
+    map[ids[10]] = 2;
+    CHECK(map.size() == 2);
+    CHECK(map[fluent::optional<OrderId>{}] == 1);
+}
+
+using NodeIndex = fluent::NamedType<uint32_t, struct NodeIndexTag, fluent::Incrementable, fluent::Comparable>;
+
+TEST_CASE("StrongVector")
+{
+    fluent::StrongVector<NodeIndex, std::string> names = {"a", "b"};
+    CHECK(names.size() == 2);
+    CHECK(names[NodeIndex{1}] == "b");
+    CHECK(names.push_back("c") == NodeIndex{2});
+    CHECK(names.next_index() == NodeIndex{3});
+    CHECK(names.at(NodeIndex{2}) == "c");
+    CHECK_THROWS_AS(names.at(NodeIndex{3}), std::out_of_range);
+    CHECK(names.contains(NodeIndex{2}));
+    CHECK(!names.contains(NodeIndex{3}));
+
+    names[NodeIndex{0}] = "z";
+    CHECK(names.front() == "z");
+    CHECK(names.vector() == std::vector<std::string>{"z", "b", "c"});
+
+    std::string concatenation;
+    for (auto const& name : names)
+    {
+        concatenation += name;
+    }
+    CHECK(concatenation == "zbc");
+
+    static_assert(
+        !std::is_convertible<uint32_t, NodeIndex>::value, "StrongVector can be indexed by a raw integer");
+}
+
+TEST_CASE("StrongVector indices")
+{
+    fluent::StrongVector<NodeIndex, int> values(5, 0);
+    for (NodeIndex index : values.indices())
+    {
+        values[index] = static_cast<int>(index.get() * 10);
+    }
+    CHECK(values.vector() == std::vector<int>{0, 10, 20, 30, 40});
+
+    auto const indices = values.indices();
+    CHECK(indices.size() == 5);
+    CHECK(std::distance(indices.begin(), indices.end()) == 5);
+    CHECK(*(indices.begin() + 3) == NodeIndex{3});
+    CHECK(indices.begin()[4] == NodeIndex{4});
+}
+
+TEST_CASE("iota")
+{
+    std::vector<uint32_t> values;
+    for (NodeIndex index : fluent::iota(NodeIndex{3}, NodeIndex{7}))
+    {
+        values.push_back(index.get());
+    }
+    CHECK(values == std::vector<uint32_t>{3, 4, 5, 6});
+
+    auto const range = fluent::iota(NodeIndex{3}, NodeIndex{7});
+    CHECK(range.size() == 4);
+    CHECK(!range.empty());
+    CHECK(fluent::iota(NodeIndex{3}, NodeIndex{3}).empty());
+    CHECK(std::distance(range.begin(), range.end()) == 4);
+    CHECK(*(range.begin() + 2) == NodeIndex{5});
+    CHECK(*(range.end() - 1) == NodeIndex{6});
+    CHECK(range.begin()[1] == NodeIndex{4});
+    auto const sum = [](uint32_t total, NodeIndex index) { return total + index.get(); };
+    CHECK(std::accumulate(range.begin(), range.end(), 0u, sum) == 18);
+    static_assert(std::is_same<decltype(range.begin())::iterator_category, std::input_iterator_tag>::value,
+                  "iota iterators return values, and are not forward iterators");
+}
+
+TEST_CASE("iota_n")
+{
+    using Offset = fluent::NamedType<int, struct OffsetTag, fluent::Incrementable>;
+    std::vector<int> values;
+    for (Offset offset : fluent::iota_n(Offset{-2}, 4))
+    {
+        values.push_back(offset.get());
+    }
+    CHECK(values == std::vector<int>{-2, -1, 0, 1});
+    CHECK(fluent::iota_n(Offset{-2}, 4).size() == 4);
+}
+
+TEST_CASE("iota constexpr")
+{
+    static_assert(fluent::iota(NodeIndex{3}, NodeIndex{7}).size() == 4, "iota is not constexpr");
+    static_assert(*fluent::iota(NodeIndex{3}, NodeIndex{7}).begin() == NodeIndex{3}, "iota is not constexpr");
+}
+
+using TradePrice = fluent::NamedType<double, struct TradePriceTag>;
+using TradeQuantity = fluent::NamedType<int, struct TradeQuantityTag, fluent::Addable>;
+using TradeTimestamp = fluent::NamedType<int64_t, struct TradeTimestampTag>;
+using Trades = fluent::soa_table<TradePrice, TradeQuantity, TradeTimestamp>;
+
+TEST_CASE("soa_table columns")
+{
+    Trades trades;
+    CHECK(trades.empty());
+    trades.push_back(TradePrice{1.5}, TradeQuantity{10}, TradeTimestamp{100});
+    trades.push_back(TradeTimestamp{200}, TradePrice{2.5}, TradeQuantity{20}); // any order
+    CHECK(trades.size() == 2);
+
+    std::vector<TradeQuantity> const& quantities = trades.column<TradeQuantity>();
+    auto const total = std::accumulate(quantities.begin(), quantities.end(), TradeQuantity{0});
+    CHECK(total.get() == 30);
+    CHECK(trades.column<TradeTimestamp>()[1].get() == 200);
+
+    trades.pop_back();
+    CHECK(trades.size() == 1);
+    CHECK(trades.column<TradePrice>().size() == 1);
+    trades.clear();
+    CHECK(trades.empty());
+}
+
+TEST_CASE("soa_table rows")
+{
+    Trades trades;
+    trades.reserve(3);
+    trades.push_back(TradePrice{1.5}, TradeQuantity{10}, TradeTimestamp{100});
+    trades.push_back(TradePrice{2.5}, TradeQuantity{20}, TradeTimestamp{200});
+    trades.push_back(TradePrice{3.5}, TradeQuantity{30}, TradeTimestamp{300});
+
+    trades[1].get<TradeQuantity>() = TradeQuantity{25};
+    CHECK(trades.column<TradeQuantity>()[1].get() == 25);
+    static_assert(std::is_same<decltype(trades[0].get<TradePrice>()), TradePrice&>::value, "rows lose strong types");
+
+    Trades const& constTrades = trades;
+    static_assert(std::is_same<decltype(constTrades[0].get<TradePrice>()), TradePrice const&>::value,
+                  "const rows give mutable access");
+    CHECK(std::get<TradeTimestamp>(constTrades[2].values()).get() == 300);
+
+    int64_t timestamps = 0;
+    for (auto row : constTrades)
+    {
+        timestamps += row.get<TradeTimestamp>().get();
+    }
+    CHECK(timestamps == 600);
+    CHECK(std::distance(trades.begin(), trades.end()) == 3);
+    CHECK((*(trades.begin() + 2)).position() == 2);
+    CHECK((2 + trades.begin()) == trades.end() - 1);
+    CHECK(trades.end() > trades.begin());
+    CHECK(trades.begin() <= trades.begin());
+    CHECK(trades.end() >= trades.begin() + 3);
+    static_assert(std::is_same<Trades::iterator::iterator_category, std::input_iterator_tag>::value,
+                  "row iterators return proxies, and are not forward iterators");
+}
+
+// Throws when copying negative values, and when default constructed
+struct FragileValue
+{
+    explicit FragileValue(int initialValue) : value(initialValue)
+    {
+    }
+    FragileValue() : value(0)
+    {
+        throw std::runtime_error("FragileValue can't be default constructed");
+    }
+    FragileValue(FragileValue const& other) : value(other.value)
+    {
+        if (value < 0)
+        {
+            throw std::runtime_error("FragileValue can't be copied");
+        }
+    }
+    FragileValue& operator=(FragileValue const&) = default;
+    ~FragileValue() = default;
+
+    int value;
+};
+
+TEST_CASE("soa_table keeps its columns aligned when a field throws")
+{
+    fluent::soa_table<TradePrice, FragileValue> table;
+    table.push_back(TradePrice{1.5}, FragileValue{1});
+    CHECK_THROWS_AS(table.push_back(TradePrice{2.5}, FragileValue{-1}), std::runtime_error);
+    CHECK(table.size() == 1);
+    CHECK(table.column<TradePrice>().size() == 1);
+    CHECK_THROWS_AS(table.resize(3), std::runtime_error);
+    CHECK(table.column<TradePrice>().size() == 1);
+    CHECK(table.column<FragileValue>().size() == 1);
+    CHECK(table[0].get<FragileValue>().value == 1);
+}
+
+using OrderSide = fluent::NamedType<char, struct OrderSideTag, fluent::Comparable>;
+using OrderPrice = fluent::NamedType<double, struct OrderPriceTag>;
+using OrderUrgent = fluent::NamedType<bool, struct OrderUrgentTag, fluent::Comparable>;
+using OrderQuantity = fluent::NamedType<int32_t, struct OrderQuantityTag, fluent::Comparable>;
+using Order = fluent::record<OrderSide, OrderPrice, OrderUrgent, OrderQuantity>;
+
+TEST_CASE("record field access")
+{
+    Order order(OrderQuantity{100}, OrderPrice{10.5}, OrderSide{'B'}, OrderUrgent{false}); // any order
+    CHECK(order.get<OrderSide>().get() == 'B');
+    CHECK(order.get<OrderPrice>().get() == Approx(10.5));
+    CHECK(order.get<OrderQuantity>().get() == 100);
+
+    order.get<OrderQuantity>() = OrderQuantity{200};
+    CHECK(order.get<OrderQuantity>().get() == 200);
+    Order const& constOrder = order;
+    static_assert(std::is_same<decltype(constOrder.get<OrderPrice>()), OrderPrice const&>::value,
+                  "const records give mutable access");
+    static_assert(!std::is_constructible<Order, OrderSide, OrderPrice>::value, "records can miss fields");
+}
+
+TEST_CASE("record layout")
+{
+    struct DeclarationOrder
+    {
+        char side;
+        double price;
+        bool urgent;
+        int32_t quantity;
+    };
+    static_assert(sizeof(DeclarationOrder) == 24, "unexpected test platform");
+    static_assert(sizeof(Order) == 16, "record does not minimize padding");
+    static_assert(Order::serialized_size == 14, "records are serialized without padding");
+    static_assert(std::is_trivially_copyable<Order>::value, "record is not trivially copyable");
+}
+
+TEST_CASE("record serialization")
+{
+    Order const order(OrderSide{'S'}, OrderPrice{2.5}, OrderUrgent{true}, OrderQuantity{7});
+    unsigned char bytes[Order::serialized_size];
+    order.serialize(bytes);
+    Order const copy = Order::deserialize(bytes);
+    CHECK(copy.get<OrderSide>() == OrderSide{'S'});
+    CHECK(copy.get<OrderPrice>().get() == Approx(2.5));
+    CHECK(copy.get<OrderUrgent>() == OrderUrgent{true});
+    CHECK(copy.get<OrderQuantity>() == OrderQuantity{7});
+
+    using Point = fluent::record<OrderSide, OrderQuantity>;
+    static_assert(sizeof(Point) == 8 && Point::serialized_size == 5, "records are serialized without padding");
+    unsigned char pointBytes[Point::serialized_size + 1] = {};
+    pointBytes[Point::serialized_size] = 0xAB;
+    Point(OrderQuantity{-2}, OrderSide{'p'}).serialize(pointBytes);
+    CHECK(pointBytes[0] == 'p'); // declaration order
+    CHECK(pointBytes[Point::serialized_size] == 0xAB);
+    CHECK(Point::deserialize(pointBytes) == Point(OrderSide{'p'}, OrderQuantity{-2}));
+
+    CHECK(Point(OrderSide{'a'}, OrderQuantity{1}) == Point(OrderQuantity{1}, OrderSide{'a'}));
+    CHECK(Point(OrderSide{'a'}, OrderQuantity{1}) != Point(OrderSide{'a'}, OrderQuantity{2}));
+}
+
+TEST_CASE("record constexpr")
+{
+    using Point = fluent::record<OrderSide, OrderQuantity>;
+    constexpr Point point(OrderQuantity{3}, OrderSide{'x'});
+    static_assert(point.get<OrderQuantity>().get() == 3, "record is not constexpr");
+}
+
+using EntityHandle = fluent::NamedType<uint32_t, struct EntityHandleTag, fluent::Comparable>;
+
+TEST_CASE("slot_map lookup")
+{
+    fluent::slot_map<EntityHandle, std::string> names;
+    EntityHandle const a = names.insert("a");
+    EntityHandle const b = names.insert("b");
+    EntityHandle const c = names.emplace(1, 'c');
+    CHECK(names.size() == 3);
+    CHECK(names[a] == "a");
+    CHECK(names.at(b) == "b");
+    CHECK(*names.find(c) == "c");
+
+    CHECK(names.erase(a));
+    CHECK(names.size() == 2);
+    CHECK(!names.contains(a));
+    CHECK(names.find(a) == nullptr);
+    CHECK_THROWS_AS(names.at(a), std::out_of_range);
+    CHECK(!names.erase(a));
+    CHECK(names[b] == "b");
+    CHECK(names[c] == "c");
+}
+
+TEST_CASE("slot_map rejects stale handles of reused slots")
+{
+    fluent::slot_map<EntityHandle, int> values;
+    EntityHandle const first = values.insert(1);
+    values.erase(first);
+    EntityHandle const second = values.insert(2);
+    CHECK(second != first);
+    CHECK(!values.contains(first));
+    CHECK(values[second] == 2);
+
+    values.clear();
+    CHECK(values.empty());
+    CHECK(!values.contains(second));
+}
+
+TEST_CASE("slot_map retires slots instead of wrapping their generation around")
+{
+    using SmallHandle = fluent::NamedType<uint16_t, struct SmallHandleTag, fluent::Comparable>;
+    fluent::slot_map<SmallHandle, int, 12> values; // 4 bits of generation
+    std::vector<SmallHandle> staleHandles;
+    for (int generation = 0; generation < 16; ++generation)
+    {
+        staleHandles.push_back(values.insert(generation));
+        values.erase(staleHandles.back());
+    }
+    CHECK((staleHandles.back().get() & 0xFFF) == 0); // all in the first slot
+
+    SmallHandle const handle = values.insert(16);
+    CHECK((handle.get() & 0xFFF) == 1);
+    for (SmallHandle const& staleHandle : staleHandles)
+    {
+        CHECK(!values.contains(staleHandle));
+    }
+    CHECK(!values.contains(SmallHandle{0}));
+    CHECK(values[handle] == 16);
+}
+
+TEST_CASE("slot_map iteration")
+{
+    fluent::slot_map<EntityHandle, int> values;
+    std::vector<EntityHandle> handles;
+    for (int value = 0; value < 5; ++value)
+    {
+        handles.push_back(values.insert(value));
+    }
+    values.erase(handles[1]);
+    values.erase(handles[3]);
+    CHECK(std::accumulate(values.begin(), values.end(), 0) == 0 + 2 + 4);
+    for (std::size_t position = 0; position < values.size(); ++position)
+    {
+        CHECK(values[values.handle_at(position)] == *(values.begin() + static_cast<std::ptrdiff_t>(position)));
+    }
+}
+
+TEST_CASE("id_generator")
+{
+    using RequestId = fluent::NamedType<uint64_t, struct RequestIdTag, fluent::Comparable>;
+    using Generator = fluent::id_generator<RequestId, 16>;
+
+    constexpr std::size_t threadCount = 4;
+    constexpr std::size_t idsPerThread = 1000;
+    std::vector<std::vector<RequestId>> ids(threadCount);
+    std::vector<std::thread> threads;
+    for (auto& threadIds : ids)
+    {
+        threads.emplace_back([&threadIds] {
+            for (std::size_t i = 0; i < idsPerThread; ++i)
+            {
+                threadIds.push_back(Generator::next());
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<uint64_t> allIds;
+    for (auto const& threadIds : ids)
+    {
+        CHECK(std::is_sorted(threadIds.begin(), threadIds.end()));
+        for (RequestId id : threadIds)
+        {
+            allIds.push_back(id.get());
+        }
+    }
+    std::sort(allIds.begin(), allIds.end());
+    CHECK(std::adjacent_find(allIds.begin(), allIds.end()) == allIds.end());
+    CHECK(allIds.size() == threadCount * idsPerThread);
+}
+
+TEST_CASE("next_id")
+{
+    using SessionId = fluent::NamedType<uint32_t, struct SessionIdTag, fluent::Comparable>;
+    SessionId const first = fluent::next_id<SessionId>();
+    SessionId const second = fluent::next_id<SessionId>();
+    CHECK(first < second);
+}
+
+TEST_CASE("id_generators of the same type share their counter")
+{
+    using TicketId = fluent::NamedType<uint16_t, struct TicketIdTag, fluent::Comparable>;
+    TicketId const single = fluent::id_generator<TicketId, 1>::next();
+    TicketId const blocked = fluent::id_generator<TicketId, 100>::next();
+    TicketId const defaulted = fluent::next_id<TicketId>();
+    CHECK(single != blocked);
+    CHECK(blocked != defaulted);
+    CHECK(single != defaulted);
+    CHECK(fluent::id_generator<TicketId, 1>::next() == TicketId{1125}); // after blocks of 1, 100 and 1024 values
+    CHECK(sizeof(fluent::details::IdCounter<TicketId>) % fluent::cache_line_size == 0);
+}
+
+using HitCount = fluent::NamedType<uint64_t, struct HitCountTag, fluent::Comparable>;
+
+TEST_CASE("atomic")
+{
+    fluent::atomic<HitCount> hits(HitCount{5});
+    CHECK(hits.load() == HitCount{5});
+    hits.store(HitCount{7}, std::memory_order_release);
+    CHECK(hits.load(std::memory_order_acquire) == HitCount{7});
+    CHECK(hits.exchange(HitCount{8}) == HitCount{7});
+    CHECK(hits.fetch_add(HitCount{2}) == HitCount{8});
+    CHECK(hits.fetch_sub(HitCount{1}) == HitCount{10});
+
+    HitCount expected{0};
+    CHECK(!hits.compare_exchange_strong(expected, HitCount{20}));
+    CHECK(expected == HitCount{9});
+    CHECK(hits.compare_exchange_strong(expected, HitCount{20}, std::memory_order_acq_rel, std::memory_order_acquire));
+    CHECK(hits.load() == HitCount{20});
+
+    static_assert(std::is_same<decltype(hits.load()), HitCount>::value, "atomic loses the strong type");
+    static_assert(!std::is_copy_constructible<fluent::atomic<HitCount>>::value, "atomic is copyable");
+}
+
+TEST_CASE("atomic across threads")
+{
+    fluent::atomic<HitCount> hits;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&hits]() noexcept {
+            for (int hit = 0; hit < 1000; ++hit)
+            {
+                hits.fetch_add(HitCount{1}, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(hits.load() == HitCount{4000});
+}
+
+TEST_CASE("sharded_counter")
+{
+    fluent::sharded_counter<HitCount> hits;
+    CHECK(hits.load() == HitCount{0});
+    ++hits;
+    hits += HitCount{2};
+    hits.add(HitCount{3});
+    CHECK(hits.load() == HitCount{6});
+    hits.reset();
+    CHECK(hits.load() == HitCount{0});
+    static_assert(alignof(fluent::sharded_counter<HitCount>) >= fluent::cache_line_size, "shards share cache lines");
+}
+
+TEST_CASE("sharded_counter across threads")
+{
+    fluent::sharded_counter<HitCount, 2> hits;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&hits]() noexcept {
+            for (int hit = 0; hit < 1000; ++hit)
+            {
+                ++hits;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(hits.load() == HitCount{4000});
+}
+
+TEST_CASE("CacheAligned")
+{
+    using PaddedCount =
+        fluent::NamedType<int, struct PaddedCountTag, fluent::CacheAligned, fluent::Addable, fluent::Comparable>;
+    static_assert(sizeof(PaddedCount) == fluent::cache_line_size, "CacheAligned does not pad to a cache line");
+    static_assert(alignof(PaddedCount) == fluent::cache_line_size, "CacheAligned does not align on a cache line");
+
+    PaddedCount counts[2] = {PaddedCount{1}, PaddedCount{2}};
+    CHECK(counts[0] + counts[1] == PaddedCount{3});
+    auto const address = [](PaddedCount const& count) { return reinterpret_cast<std::uintptr_t>(&count); };
+    CHECK(address(counts[0]) % fluent::cache_line_size == 0);
+    CHECK(address(counts[1]) - address(counts[0]) == fluent::cache_line_size);
+
+    std::vector<PaddedCount> perThreadCounts(2, PaddedCount{0});
+    CHECK(address(perThreadCounts[1]) % fluent::cache_line_size == 0);
+}
+
+TEST_CASE("seqlocked")
+{
+    fluent::seqlocked<HitCount> hits(HitCount{3});
+    CHECK(hits.load() == HitCount{3});
+    hits.store(HitCount{4});
+    HitCount value{0};
+    CHECK(hits.try_load(value));
+    CHECK(value == HitCount{4});
+    static_assert(std::is_same<decltype(hits.load()), HitCount>::value, "seqlocked loses the strong type");
+}
+
+TEST_CASE("seqlocked readers see consistent records")
+{
+    using Quote = fluent::record<OrderPrice, OrderQuantity, HitCount>;
+    fluent::seqlocked<Quote> quote(Quote(OrderPrice{0}, OrderQuantity{0}, HitCount{0}));
+
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistentReads{0};
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 3; ++reader)
+    {
+        readers.emplace_back([&]() noexcept {
+            while (!done.load())
+            {
+                Quote const read = quote.load();
+                auto const quantity = read.get<OrderQuantity>().get();
+                if (read.get<HitCount>().get() != static_cast<uint64_t>(quantity) * 2
+                    || std::lround(read.get<OrderPrice>().get()) != quantity)
+                {
+                    ++inconsistentReads;
+                }
+            }
+        });
+    }
+    for (int32_t i = 1; i <= 20000; ++i)
+    {
+        auto const hits = HitCount{static_cast<uint64_t>(i) * 2};
+        quote.store(Quote(OrderPrice{static_cast<double>(i)}, OrderQuantity{i}, hits));
+    }
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    CHECK(inconsistentReads.load() == 0);
+    CHECK(quote.load().get<OrderQuantity>() == OrderQuantity{20000});
+}
+
+using PacketLength = fluent::NamedType<uint16_t, struct PacketLengthTag, fluent::Addable, fluent::Comparable>;
+using PacketSequence = fluent::NamedType<uint32_t, struct PacketSequenceTag, fluent::Comparable>;
+using PacketTime = fluent::NamedType<double, struct PacketTimeTag>;
+
+struct PacketHeader
+{
+    fluent::BigEndian<PacketLength> length;
+    fluent::LittleEndian<PacketSequence> sequence;
+    fluent::Unaligned<PacketTime> time;
+};
+
+TEST_CASE("Byte ordered values overlay bytes")
+{
+    static_assert(sizeof(PacketHeader) == 2 + 4 + 8, "byte ordered values are padded");
+    static_assert(alignof(PacketHeader) == 1, "byte ordered values have alignment requirements");
+
+    unsigned char bytes[1 + sizeof(PacketHeader)] = {0, 0x01, 0x02, 0x04, 0x03, 0x02, 0x01};
+    double const time = 1.5;
+    std::memcpy(bytes + 7, &time, sizeof(time));
+
+    PacketHeader const& header = fluent::overlay<PacketHeader>(bytes + 1); // unaligned
+    CHECK(header.length.get() == PacketLength{0x0102});
+    CHECK(header.sequence.get() == PacketSequence{0x01020304});
+    CHECK(header.time.get().get() == Approx(1.5));
+}
+
+TEST_CASE("Byte ordered values encode bytes")
+{
+    unsigned char bytes[sizeof(PacketHeader)] = {};
+    PacketHeader& header = fluent::overlay<PacketHeader>(bytes);
+    header.length = PacketLength{0x0A0B};
+    header.sequence.set(PacketSequence{0x0A0B0C0D});
+    CHECK(bytes[0] == 0x0A);
+    CHECK(bytes[1] == 0x0B);
+    CHECK(bytes[2] == 0x0D);
+    CHECK(bytes[5] == 0x0A);
+}
+
+TEST_CASE("Byte ordered values keep the skills of their strong type")
+{
+    fluent::BigEndian<PacketLength> const length(PacketLength{10});
+    fluent::LittleEndian<PacketLength> const otherLength(PacketLength{12});
+    CHECK(length.get() + PacketLength{2} == PacketLength{12});
+    CHECK(length < otherLength);
+    CHECK(length == PacketLength{10});
+    CHECK(PacketLength{12} == otherLength);
+    CHECK(length != otherLength);
+    PacketLength const converted = length;
+    CHECK(converted == PacketLength{10});
+}
+
+using TaskPriority = fluent::NamedType<uint8_t, struct TaskPriorityTag, fluent::Comparable>;
+using TaskShard = fluent::NamedType<uint16_t, struct TaskShardTag, fluent::Comparable, fluent::Addable>;
+using TaskOffset = fluent::NamedType<int, struct TaskOffsetTag, fluent::Comparable>;
+using TaskFlag = fluent::NamedType<bool, struct TaskFlagTag, fluent::Comparable>;
+using TaskHeader = fluent::bitpack<fluent::Field<TaskPriority, 3>,
+                                   fluent::Field<TaskShard, 10>,
+                                   fluent::Field<TaskOffset, 5>,
+                                   fluent::Field<TaskFlag, 1>>;
+
+TEST_CASE("bitpack")
+{
+    static_assert(sizeof(TaskHeader) == sizeof(uint32_t), "bitpack does not use the smallest word");
+
+    TaskHeader header(TaskShard{1000}, TaskPriority{5}, TaskFlag{true}, TaskOffset{-3}); // any order
+    CHECK(header.get<TaskPriority>() == TaskPriority{5});
+    CHECK(header.get<TaskShard>() == TaskShard{1000});
+    CHECK(header.get<TaskOffset>() == TaskOffset{-3});
+    CHECK(header.get<TaskFlag>() == TaskFlag{true});
+    CHECK(header.get<TaskShard>() + TaskShard{1} == TaskShard{1001});
+
+    header.set(TaskOffset{15});
+    CHECK(header.get<TaskOffset>() == TaskOffset{15});
+    CHECK(header.get<TaskShard>() == TaskShard{1000});
+    header.set(TaskOffset{-16});
+    CHECK(header.get<TaskOffset>() == TaskOffset{-16});
+    CHECK(header.get<TaskFlag>() == TaskFlag{true});
+    static_assert(std::is_same<decltype(header.get<TaskShard>()), TaskShard>::value, "bitpack loses the strong type");
+}
+
+TEST_CASE("bitpack raw word")
+{
+    TaskHeader const header(TaskPriority{1}, TaskShard{2}, TaskOffset{0}, TaskFlag{false});
+    CHECK(header.raw() == (1u | (2u << 3)));
+    CHECK(TaskHeader::fromRaw(header.raw()) == header);
+    CHECK(TaskHeader::fromRaw(0) != header);
+    CHECK(TaskHeader{} == TaskHeader::fromRaw(0));
+    static_assert(TaskHeader::fromRaw(8).get<TaskShard>().get() == 1, "bitpack is not constexpr");
+}
+
+struct ListNode
+{
+    int value;
+    fluent::offset_ptr<ListNode, struct ListRegionTag> next;
+};
+
+TEST_CASE("offset_ptr survives relocation of its region")
+{
+    ListNode nodes[3] = {};
+    fluent::region<struct ListRegionTag> const original(nodes, sizeof(nodes));
+    for (int i = 0; i < 3; ++i)
+    {
+        nodes[i].value = i * 10;
+        nodes[i].next = i < 2 ? original.offset_of(&nodes[i + 1]) : nullptr;
+    }
+
+    ListNode relocated[3] = {};
+    std::memcpy(relocated, nodes, sizeof(nodes));
+    fluent::region<struct ListRegionTag> const copy(relocated, sizeof(relocated));
+    std::vector<int> values;
+    for (ListNode const* node = &relocated[0]; node != nullptr; node = copy.get(node->next))
+    {
+        values.push_back(node->value);
+    }
+    CHECK(values == std::vector<int>{0, 10, 20});
+    CHECK(&copy[relocated[0].next] == &relocated[1]);
+    static_assert(std::is_trivially_copyable<fluent::offset_ptr<ListNode, struct ListRegionTag>>::value,
+                  "offset_ptr can't be stored in mapped memory");
+}
+
+TEST_CASE("offset_ptr arithmetic")
+{
+    using NodePointer = fluent::offset_ptr<ListNode, struct ListRegionTag>;
+    NodePointer const first = NodePointer::fromRaw(0);
+    NodePointer const third = first + 2;
+    CHECK(third.raw() == 2 * sizeof(ListNode));
+    CHECK(third - first == 2);
+    CHECK(third - 1 == first + 1);
+    CHECK(first < third);
+    NodePointer pointer = first;
+    ++pointer;
+    pointer += 1;
+    CHECK(pointer == third);
+    CHECK(!NodePointer{});
+    CHECK(first);
+    fluent::offset_ptr<ListNode const, struct ListRegionTag> const constPointer = third;
+    CHECK(constPointer.raw() == third.raw());
+
+    static_assert(!std::is_convertible<fluent::offset_ptr<ListNode, struct OtherRegionTag>, NodePointer>::value,
+                  "offset_ptrs of different regions can be mixed up");
+    static_assert(!std::is_convertible<fluent::offset_ptr<int, struct ListRegionTag>, NodePointer>::value,
+                  "offset_ptrs to different types can be mixed up");
+}
+
+TEST_CASE("offset_ptr in a region with small offsets")
+{
+    std::vector<unsigned char> bytes(std::numeric_limits<uint16_t>::max());
+    fluent::region<struct SmallRegionTag, uint16_t> const small(bytes.data(), bytes.size()); // the largest one
+    static_assert(std::is_same<decltype(small.offset_of(&bytes[0])),
+                               fluent::offset_ptr<unsigned char, struct SmallRegionTag, uint16_t>>::value,
+                  "offset_of doesn't use the offsets of its region");
+    auto const last = small.offset_of(&bytes.back());
+    CHECK(last);
+    CHECK(last.raw() == std::numeric_limits<uint16_t>::max() - 1);
+    CHECK(small.get(last) == &bytes.back());
+    CHECK(small.offset_of<uint32_t>(&bytes.back()).raw() == last.raw());
+}
+
+using WirePrice = fluent::NamedType<double, struct WirePriceTag, fluent::Serializable>;
+using WireQuantity = fluent::NamedType<int32_t, struct WireQuantityTag, fluent::Serializable, fluent::Comparable>;
+using WireSymbol = fluent::NamedType<std::string, struct WireSymbolTag, fluent::Serializable, fluent::Comparable>;
+using WireCount = fluent::NamedType<int, struct WireCountTag, fluent::Serializable, fluent::NonZero>;
+
+TEST_CASE("Serialization of strong types")
+{
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::serialize(writer, WireQuantity{42});
+    fluent::serialize(writer, WireSymbol{"ABC"});
+    CHECK(bytes.size() == sizeof(int32_t) + sizeof(uint64_t) + 3);
+
+    fluent::byte_reader reader(bytes);
+    CHECK(fluent::deserialize<WireQuantity>(reader) == WireQuantity{42});
+    CHECK(fluent::deserialize<WireSymbol>(reader) == WireSymbol{"ABC"});
+    CHECK(reader.remaining() == 0);
+    CHECK_THROWS_AS(fluent::deserialize<WireQuantity>(reader), std::out_of_range);
+}
+
+TEST_CASE("Serialization of sequences and records")
+{
+    using Quote = fluent::record<WirePrice, WireQuantity>;
+    using NamedQuote = fluent::record<WireSymbol, WireQuantity>;
+    std::vector<WireQuantity> const quantities = {WireQuantity{1}, WireQuantity{2}, WireQuantity{3}};
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::serialize(writer, quantities);
+    CHECK(bytes.size() == sizeof(uint64_t) + 3 * sizeof(int32_t)); // one memcpy for the values
+    static_assert(!fluent::details::IsTriviallySerializable<Quote>::value, "padded records are copied with memcpy");
+    using WireVolume = fluent::NamedType<int32_t, struct WireVolumeTag, fluent::Serializable>;
+    static_assert(fluent::details::IsTriviallySerializable<fluent::record<WireQuantity, WireVolume>>::value,
+                  "records without padding are not copied with memcpy");
+    fluent::serialize(writer, Quote(WirePrice{2.5}, WireQuantity{10}));
+    CHECK(bytes.size() == sizeof(uint64_t) + 3 * sizeof(int32_t) + sizeof(double) + sizeof(int32_t)); // no padding
+    fluent::serialize(writer, NamedQuote(WireSymbol{"XYZ"}, WireQuantity{20}));
+    fluent::serialize(writer, quantities.data(), 2);
+
+    fluent::byte_reader reader(bytes);
+    CHECK(fluent::deserialize<std::vector<WireQuantity>>(reader) == quantities);
+    Quote const quote = fluent::deserialize<Quote>(reader);
+    CHECK(quote.get<WirePrice>().get() == Approx(2.5));
+    CHECK(quote.get<WireQuantity>() == WireQuantity{10});
+    CHECK(fluent::deserialize<NamedQuote>(reader) == NamedQuote(WireSymbol{"XYZ"}, WireQuantity{20}));
+    WireQuantity span[2] = {WireQuantity{0}, WireQuantity{0}};
+    fluent::deserialize(reader, span, 2);
+    CHECK(span[1] == WireQuantity{2});
+}
+
+TEST_CASE("Deserialization checks invariants")
+{
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::serialize(writer, std::vector<int>{3, 0});
+    fluent::byte_reader reader(bytes);
+    CHECK_THROWS_AS(fluent::deserialize<std::vector<WireCount>>(reader), std::invalid_argument);
+}
+
+TEST_CASE("Versioned serialization")
+{
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::serialize_versioned(writer, WireQuantity{7}, 1); // version 1: a quantity
+    fluent::serialize_versioned(writer, fluent::record<WireSymbol, WireQuantity>(WireSymbol{"A"}, WireQuantity{8}), 2);
+
+    using QuoteV2 = fluent::record<WireSymbol, WireQuantity>;
+    auto const upgrade = [](fluent::byte_reader& oldReader, uint32_t version) {
+        CHECK(version == 1);
+        return QuoteV2(WireSymbol{"?"}, fluent::deserialize<WireQuantity>(oldReader));
+    };
+    fluent::byte_reader reader(bytes);
+    CHECK(fluent::deserialize_versioned<QuoteV2>(reader, 2, upgrade).get<WireQuantity>() == WireQuantity{7});
+    CHECK(fluent::deserialize_versioned<QuoteV2>(reader, 2, upgrade).get<WireSymbol>() == WireSymbol{"A"});
+
+    fluent::byte_reader newerReader(bytes);
+    CHECK_THROWS_AS(fluent::deserialize_versioned<QuoteV2>(newerReader, 0, upgrade), std::runtime_error);
+}
+
+using VarintId = fluent::NamedType<uint64_t, struct VarintIdTag, fluent::VarintEncodable, fluent::Comparable>;
+using VarintDelta = fluent::NamedType<int32_t, struct VarintDeltaTag, fluent::VarintEncodable, fluent::Comparable>;
+
+TEST_CASE("Varint encoding")
+{
+    static_assert(fluent::varint_size(VarintId{127}) == 1, "varint_size should be constexpr");
+    CHECK(fluent::varint_size(VarintId{128}) == 2);
+    CHECK(fluent::varint_size(VarintId{std::numeric_limits<uint64_t>::max()}) == fluent::max_varint_size);
+    CHECK(fluent::varint_size(VarintDelta{-1}) == 1);
+    CHECK(fluent::varint_size(VarintDelta{-65}) == 2);
+
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::encode_varint(writer, VarintId{300});
+    CHECK(bytes == std::vector<unsigned char>{0xAC, 0x02});
+    fluent::encode_varint(writer, VarintDelta{std::numeric_limits<int32_t>::min()});
+    fluent::serialize(writer, VarintId{std::numeric_limits<uint64_t>::max()}); // serialize uses the varint encoding
+    CHECK(bytes.size() == 2 + 5 + 10);
+
+    fluent::byte_reader reader(bytes);
+    CHECK(fluent::decode_varint<VarintId>(reader) == VarintId{300});
+    CHECK(fluent::decode_varint<VarintDelta>(reader) == VarintDelta{std::numeric_limits<int32_t>::min()});
+    CHECK(fluent::deserialize<VarintId>(reader) == VarintId{std::numeric_limits<uint64_t>::max()});
+    CHECK_THROWS_AS(fluent::decode_varint<VarintId>(reader), std::out_of_range);
+}
+
+TEST_CASE("Varint decoding rejects malformed bytes")
+{
+    std::vector<unsigned char> const truncated = {0x80, 0x80};
+    fluent::byte_reader truncatedReader(truncated);
+    CHECK_THROWS_AS(fluent::decode_varint<VarintId>(truncatedReader), std::out_of_range);
+    CHECK(truncatedReader.remaining() == 2);
+
+    std::vector<unsigned char> const tooLong(11, 0x80);
+    fluent::byte_reader tooLongReader(tooLong);
+    CHECK_THROWS_AS(fluent::decode_varint<VarintId>(tooLongReader), std::out_of_range);
+
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::encode_varint(writer, VarintId{uint64_t{1} << 40});
+    fluent::byte_reader reader(bytes);
+    CHECK_THROWS_AS(fluent::decode_varint<VarintDelta>(reader), std::out_of_range); // doesn't fit in 32 bits
+}
+
+TEST_CASE("Varint encoding takes precedence over Serializable")
+{
+    using SerializableVarintId =
+        fluent::NamedType<uint32_t, struct SerializableVarintIdTag, fluent::Serializable, fluent::VarintEncodable>;
+    std::vector<SerializableVarintId> const ids = {SerializableVarintId{1}, SerializableVarintId{200}};
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::serialize(writer, SerializableVarintId{5});
+    CHECK(bytes.size() == 1);
+    fluent::serialize(writer, ids.data(), ids.size()); // value by value, not one memcpy
+    CHECK(bytes.size() == 1 + 1 + 2);
+
+    fluent::byte_reader reader(bytes);
+    CHECK(fluent::deserialize<SerializableVarintId>(reader).get() == 5);
+    SerializableVarintId read[2] = {SerializableVarintId{0}, SerializableVarintId{0}};
+    fluent::deserialize(reader, read, 2);
+    CHECK(read[1].get() == 200);
+    CHECK(reader.remaining() == 0);
+}
+
+TEST_CASE("Bulk varint encoding")
+{
+    std::vector<VarintDelta> deltas;
+    for (int32_t i = -100; i < 100; ++i)
+    {
+        deltas.push_back(VarintDelta{i * i * i});
+    }
+    std::vector<unsigned char> bytes;
+    fluent::byte_writer writer(bytes);
+    fluent::encode_varints(writer, deltas.data(), deltas.size());
+    std::size_t expectedSize = 0;
+    for (VarintDelta const& delta : deltas)
+    {
+        expectedSize += fluent::varint_size(delta);
+    }
+    CHECK(bytes.size() == expectedSize);
+    CHECK(bytes.size() < deltas.size() * sizeof(int32_t));
+
+    std::vector<VarintDelta> decoded(deltas.size(), VarintDelta{0});
+    fluent::byte_reader reader(bytes);
+    fluent::decode_varints(reader, decoded.data(), decoded.size());
+    CHECK(decoded == deltas);
+    CHECK(reader.remaining() == 0);
+
+    std::vector<unsigned char> vectorBytes;
+    fluent::byte_writer vectorWriter(vectorBytes);
+    fluent::serialize(vectorWriter, deltas);
+    CHECK(vectorBytes.size() == 1 + bytes.size() + 7); // the size is a fixed width uint64_t
+    fluent::byte_reader vectorReader(vectorBytes);
+    CHECK(fluent::deserialize<std::vector<VarintDelta>>(vectorReader) == deltas);
+}
+
+using EventTime = fluent::NamedType<int64_t, struct EventTimeTag, fluent::Comparable>;
+using EventSequence = fluent::NamedType<uint32_t, struct EventSequenceTag, fluent::Comparable>;
+
+TEST_CASE("delta_column compresses close values")
+{
+    fluent::delta_column<EventTime> times;
+    CHECK(times.empty());
+    std::vector<EventTime> expected;
+    EventTime time{1700000000000};
+    for (int i = 0; i < 1000; ++i)
+    {
+        time = EventTime{time.get() + i % 7};
+        times.push_back(time);
+        expected.push_back(time);
+    }
+    REQUIRE(times.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        REQUIRE(times[i] == expected[i]);
+    }
+    CHECK(times.at(999) == expected.back());
+    CHECK_THROWS_AS(times.at(1000), std::out_of_range);
+    CHECK(times.compressed_size() * 3 < times.size() * sizeof(EventTime));
+
+    std::vector<EventTime> scanned;
+    times.for_each([&scanned](EventTime const& value) { scanned.push_back(value); });
+    CHECK(scanned == expected);
+
+    CHECK(times.block_count() == 8);
+    EventTime block[decltype(times)::block_size];
+    CHECK(times.decode_block(7, block) == 1000 - 7 * 128);
+    CHECK(block[0] == expected[7 * 128]);
+
+    times.clear();
+    CHECK(times.empty());
+}
+
+TEST_CASE("delta_column handles any values")
+{
+    fluent::delta_column<EventTime, 4> signedValues;
+    std::vector<EventTime> const signedExpected = {EventTime{std::numeric_limits<int64_t>::max()},
+                                                   EventTime{-5},
+                                                   EventTime{std::numeric_limits<int64_t>::min()},
+                                                   EventTime{3},
+                                                   EventTime{7},
+                                                   EventTime{7},
+                                                   EventTime{7},
+                                                   EventTime{7},
+                                                   EventTime{-1}};
+    for (EventTime const& value : signedExpected)
+    {
+        signedValues.push_back(value);
+    }
+    for (std::size_t i = 0; i < signedExpected.size(); ++i)
+    {
+        CHECK(signedValues[i] == signedExpected[i]);
+    }
+
+    fluent::delta_column<EventSequence, 3> unsignedValues;
+    std::vector<EventSequence> const unsignedExpected = {
+        EventSequence{10}, EventSequence{std::numeric_limits<uint32_t>::max()}, EventSequence{0}, EventSequence{9}};
+    for (EventSequence const& value : unsignedExpected)
+    {
+        unsignedValues.push_back(value);
+    }
+    for (std::size_t i = 0; i < unsignedExpected.size(); ++i)
+    {
+        CHECK(unsignedValues[i] == unsignedExpected[i]);
+    }
+}
+
+using ColumnPrice = fluent::NamedType<double, struct ColumnPriceTag, fluent::Comparable>;
+using ColumnPriceWithSkills = fluent::NamedType<double, struct ColumnPriceTag, fluent::Comparable, fluent::Printable>;
+using ColumnVolume = fluent::NamedType<double, struct ColumnVolumeTag>;
+
+TEST_CASE("Column files")
+{
+    std::string const path = "named_type_column_file_test.col";
+    std::vector<ColumnPrice> prices;
+    for (int i = 0; i < 1000; ++i)
+    {
+        prices.push_back(ColumnPrice{i * 0.5});
+    }
+    fluent::write_column_file(path, prices);
+
+    std::vector<ColumnPrice> const read = fluent::read_column_file<ColumnPrice>(path);
+    CHECK(read == prices);
+    CHECK(fluent::read_column_file<ColumnPriceWithSkills>(path).size() == prices.size()); // skills don't matter
+    CHECK_THROWS_AS(fluent::read_column_file<ColumnVolume>(path), std::runtime_error);
+    CHECK_THROWS_AS(fluent::read_column_file<double>(path), std::runtime_error);
+
+#if FLUENT_HAS_MMAP
+    {
+        fluent::mapped_column<ColumnPrice> mapped(path);
+        REQUIRE(mapped.size() == prices.size());
+        CHECK(std::equal(mapped.begin(), mapped.end(), prices.begin()));
+        CHECK(mapped[999] == ColumnPrice{499.5});
+        CHECK(reinterpret_cast<std::uintptr_t>(mapped.data()) % 64 == 0);
+
+        fluent::mapped_column<ColumnPrice> const moved(std::move(mapped));
+        CHECK(moved.size() == prices.size());
+        CHECK(mapped.empty());
+    }
+    CHECK_THROWS_AS(fluent::mapped_column<ColumnVolume>(path), std::runtime_error);
+#endif
+
+    std::vector<char> bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    bytes.resize(bytes.size() - sizeof(ColumnPrice)); // truncates the last value
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    CHECK_THROWS_AS(fluent::read_column_file<ColumnPrice>(path), std::runtime_error);
+#if FLUENT_HAS_MMAP
+    CHECK_THROWS_AS(fluent::mapped_column<ColumnPrice>(path), std::runtime_error);
+#endif
+    std::remove(path.c_str());
+    CHECK_THROWS_AS(fluent::read_column_file<ColumnPrice>(path), std::runtime_error);
+}
+
+using SortKey = fluent::NamedType<uint64_t, struct SortKeyTag, fluent::Comparable>;
+using SortOffset = fluent::NamedType<int32_t, struct SortOffsetTag, fluent::Comparable>;
+using SortScore = fluent::NamedType<double, struct SortScoreTag, fluent::Comparable>;
+using SortName = fluent::NamedType<std::string, struct SortNameTag, fluent::Comparable>;
+
+namespace
+{
+uint64_t nextPseudoRandom(uint64_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 16;
+}
+} // namespace
+
+TEST_CASE("radix_sort of strong integers")
+{
+    uint64_t state = 42;
+    for (std::size_t const size : {std::size_t{0}, std::size_t{100}, std::size_t{10000}})
+    {
+        std::vector<SortKey> keys;
+        std::vector<SortOffset> offsets;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            uint64_t const range = i % 2 == 0 ? 1000 : std::numeric_limits<uint64_t>::max();
+            keys.push_back(SortKey{nextPseudoRandom(state) % range});
+            offsets.push_back(SortOffset{static_cast<int32_t>(nextPseudoRandom(state)) % 100000});
+        }
+        offsets.push_back(SortOffset{std::numeric_limits<int32_t>::min()});
+        offsets.push_back(SortOffset{std::numeric_limits<int32_t>::max()});
+        std::vector<SortKey> expectedKeys = keys;
+        std::vector<SortOffset> expectedOffsets = offsets;
+        std::sort(expectedKeys.begin(), expectedKeys.end());
+        std::sort(expectedOffsets.begin(), expectedOffsets.end());
+
+        fluent::radix_sort(keys.begin(), keys.end());
+        fluent::radix_sort(offsets.begin(), offsets.end());
+        CHECK(keys == expectedKeys);
+        CHECK(offsets == expectedOffsets);
+    }
+}
+
+TEST_CASE("radix_sort of strong floating point values and strings")
+{
+    uint64_t state = 7;
+    double const infinity = std::numeric_limits<double>::infinity();
+    std::vector<SortScore> scores = {SortScore{1.0}, SortScore{-infinity}, SortScore{infinity}, SortScore{-1e-300}};
+    std::vector<SortName> names = {SortName{""}, SortName{"abcdefgh"}, SortName{"abcdefghij"}, SortName{"abcdefgh"}};
+    for (int i = 0; i < 1000; ++i)
+    {
+        int64_t const numerator = static_cast<int64_t>(nextPseudoRandom(state) % 2001) - 1000;
+        scores.push_back(SortScore{static_cast<double>(numerator) / 7});
+        names.push_back(SortName{"abcdefgh" + std::to_string(nextPseudoRandom(state) % 100)});
+        names.push_back(SortName{std::to_string(nextPseudoRandom(state) % 1000)});
+    }
+    std::vector<SortScore> expectedScores = scores;
+    std::vector<SortName> expectedNames = names;
+    std::sort(expectedScores.begin(), expectedScores.end());
+    std::sort(expectedNames.begin(), expectedNames.end());
+
+    fluent::radix_sort(scores.begin(), scores.end());
+    fluent::radix_sort(names.begin(), names.end());
+    CHECK(scores == expectedScores);
+    CHECK(names == expectedNames);
+
+    std::vector<SortScore> zeros = {SortScore{0.0}, SortScore{-0.0}};
+    fluent::radix_sort(zeros.begin(), zeros.end());
+    CHECK(std::signbit(zeros.front().get()));
+}
+
+TEST_CASE("radix_sort_by a field of records is stable")
+{
+    using Entry = fluent::record<SortOffset, SortKey>;
+    std::vector<Entry> entries;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        entries.emplace_back(SortOffset{static_cast<int32_t>(i % 10) - 5}, SortKey{i});
+    }
+    fluent::radix_sort_by<SortOffset>(entries.begin(), entries.end());
+    CHECK(std::is_sorted(entries.begin(), entries.end(), [](Entry const& lhs, Entry const& rhs) {
+        return lhs.get<SortOffset>() < rhs.get<SortOffset>()
+               || (lhs.get<SortOffset>() == rhs.get<SortOffset>() && lhs.get<SortKey>() < rhs.get<SortKey>());
+    }));
+    CHECK(entries.front().get<SortOffset>() == SortOffset{-5});
+
+    std::vector<SortScore> sortedByKey = {SortScore{3.5}, SortScore{-1.5}, SortScore{2.0}};
+    fluent::radix_sort(sortedByKey.begin(), sortedByKey.end(), [](SortScore const& score) { return -score.get(); });
+    CHECK(sortedByKey.front() == SortScore{3.5});
+}
+
+using Url = fluent::NamedType<std::string, struct UrlTag, fluent::PrefixComparable, fluent::Comparable>;
+
+TEST_CASE("PrefixComparable prefixes")
+{
+    CHECK(Url{"abcdefghij"}.prefix() == 0x6162636465666768);
+    CHECK(Url{"ab"}.prefix() == 0x6162000000000000);
+    CHECK(Url{""}.prefix() == 0);
+    CHECK(Url{"\xff"}.prefix() > Url{"a"}.prefix()); // characters are compared as unsigned, as by std::string
+}
+
+TEST_CASE("prefix_keyed compares as the strings")
+{
+    std::vector<std::string> const urls = {"https://example.com/b",
+                                           "https://example.com/a",
+                                           "http://a.org",
+                                           "ftp://files",
+                                           "https://",
+                                           "https:/",
+                                           std::string("ab\0", 3),
+                                           "ab",
+                                           "",
+                                           "\xe9t\xe9",
+                                           "zz"};
+    std::vector<fluent::prefix_keyed<Url>> keyed;
+    for (std::string const& url : urls)
+    {
+        keyed.emplace_back(Url{url});
+    }
+    for (auto const& lhs : keyed)
+    {
+        for (auto const& rhs : keyed)
+        {
+            REQUIRE((lhs < rhs) == (lhs.get().get() < rhs.get().get()));
+            REQUIRE((lhs == rhs) == (lhs.get().get() == rhs.get().get()));
+            REQUIRE((lhs >= rhs) == !(lhs < rhs));
+        }
+    }
+
+    std::sort(keyed.begin(), keyed.end());
+    std::vector<std::string> sortedUrls = urls;
+    std::sort(sortedUrls.begin(), sortedUrls.end());
+    for (std::size_t i = 0; i < keyed.size(); ++i)
+    {
+        CHECK(keyed[i].get() == Url{sortedUrls[i]});
+    }
+
+    fluent::prefix_keyed<Url> const searched(Url{"https://example.com/a"});
+    auto const found = std::lower_bound(keyed.begin(), keyed.end(), searched);
+    REQUIRE(found != keyed.end());
+    CHECK(found->get() == Url{"https://example.com/a"});
+    CHECK(std::next(found)->get() == Url{"https://example.com/b"});
+}
+
+using LotSize = fluent::NamedType<int64_t, struct LotSizeTag, fluent::NonZero, fluent::Comparable, fluent::EmptyIfZero>;
+using LotOrder = fluent::record<LotSize, OrderSide>;
+
+TEST_CASE("Containers of strong types that are not default constructible")
+{
+    static_assert(!std::is_default_constructible<LotSize>::value, "NonZero types have an unchecked default value");
+
+    fluent::optional<LotSize> lot; // the empty value breaks NonZero, and is not checked
+    CHECK(!lot.has_value());
+    lot = LotSize{100};
+    CHECK(lot.value() == LotSize{100});
+    lot.reset();
+    CHECK(lot == fluent::nullopt);
+
+    fluent::seqlocked<LotSize> const sharedLot(LotSize{5});
+    CHECK(sharedLot.load() == LotSize{5});
+
+    fluent::delta_column<LotSize, 4> lots;
+    for (int64_t i = 1; i <= 10; ++i)
+    {
+        lots.push_back(LotSize{i});
+    }
+    int64_t sum = 0;
+    lots.for_each([&sum](LotSize const& size) { sum += size.get(); });
+    CHECK(sum == 55);
+
+    LotOrder const order(LotSize{7}, OrderSide{'B'});
+    unsigned char bytes[LotOrder::serialized_size];
+    order.serialize(bytes);
+    CHECK(LotOrder::deserialize(bytes) == order);
+    using Lot = fluent::record<LotSize>; // without padding, copied in one go
+    Lot(LotSize{8}).serialize(bytes);
+    CHECK(Lot::deserialize(bytes).get<LotSize>() == LotSize{8});
+
+    std::string const path = "named_type_non_default_constructible_test.col";
+    fluent::write_column_file(path, std::vector<LotSize>{LotSize{1}, LotSize{2}, LotSize{3}});
+    CHECK(fluent::read_column_file<LotSize>(path) == std::vector<LotSize>{LotSize{1}, LotSize{2}, LotSize{3}});
+    fluent::write_column_file(path, std::vector<LotSize>{});
+    CHECK(fluent::read_column_file<LotSize>(path).empty());
+    std::remove(path.c_str());
+}
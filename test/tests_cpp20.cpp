@@ -0,0 +1,103 @@
+// Tests of the features that are only available from C++20, built by the NamedTypeTest20 target
+
+#define NOGDI
+
+#include "catch.hpp"
+
+#include "NamedType/atomic.hpp"
+#include "NamedType/iota.hpp"
+#include "NamedType/named_type.hpp"
+#include "NamedType/soa_table.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using VisitCount = fluent::NamedType<uint64_t, struct VisitCountTag, fluent::Comparable>;
+
+#if defined(__cpp_lib_atomic_ref)
+
+TEST_CASE("atomic_ref")
+{
+    VisitCount visits{5};
+    fluent::atomic_ref<VisitCount> const ref(visits);
+    CHECK(ref.load() == VisitCount{5});
+    ref.store(VisitCount{7}, std::memory_order_release);
+    CHECK(ref.load(std::memory_order_acquire) == VisitCount{7});
+    CHECK(ref.exchange(VisitCount{8}) == VisitCount{7});
+    CHECK(ref.fetch_add(VisitCount{2}) == VisitCount{8});
+    CHECK(ref.fetch_sub(VisitCount{1}) == VisitCount{10});
+
+    VisitCount expected{0};
+    CHECK(!ref.compare_exchange_strong(expected, VisitCount{20}));
+    CHECK(expected == VisitCount{9});
+    CHECK(ref.compare_exchange_strong(expected, VisitCount{20}));
+    CHECK(visits == VisitCount{20}); // the referenced object is modified
+    CHECK(!ref.compare_exchange_strong(expected, VisitCount{30}, std::memory_order_acq_rel, std::memory_order_acquire));
+    CHECK(expected == VisitCount{20});
+    while (!ref.compare_exchange_weak(expected, VisitCount{30}, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    CHECK(visits == VisitCount{30});
+
+    static_assert(std::is_same<decltype(ref.load()), VisitCount>::value, "atomic_ref loses the strong type");
+}
+
+TEST_CASE("atomic_ref across threads")
+{
+    VisitCount visits{0};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&visits]() noexcept {
+            fluent::atomic_ref<VisitCount> const ref(visits);
+            for (int visit = 0; visit < 1000; ++visit)
+            {
+                ref.fetch_add(VisitCount{1}, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(visits == VisitCount{4000});
+}
+
+#endif
+
+#if defined(__cpp_lib_atomic_wait)
+
+TEST_CASE("atomic wait and notify")
+{
+    fluent::atomic<VisitCount> visits(VisitCount{0});
+    std::thread visitor([&visits]() noexcept {
+        visits.store(VisitCount{1});
+        visits.notify_one();
+    });
+    visits.wait(VisitCount{0}); // returns once the value is no longer 0
+    CHECK(visits.load() == VisitCount{1});
+    visitor.join();
+}
+
+#endif
+
+TEST_CASE("Iterators returning values are random access for ranges")
+{
+    using Row = fluent::NamedType<int, struct RowTag>;
+    using Table = fluent::soa_table<VisitCount, Row>;
+    static_assert(std::random_access_iterator<fluent::iota_range<Row>::iterator>,
+                  "iota iterators are not random access");
+    static_assert(std::random_access_iterator<Table::iterator>, "row iterators are not random access");
+
+    fluent::soa_table<VisitCount, Row> table;
+    table.push_back(VisitCount{1}, Row{2});
+    CHECK(std::ranges::distance(table.begin(), table.end()) == 1);
+
+    auto const rows = fluent::iota(Row{2}, Row{5});
+    CHECK(std::ranges::distance(rows.begin(), rows.end()) == 3);
+}